@@ -94,6 +94,11 @@ AppModel::AppModel(WalletSettings& settings)
     assert(s_instance == nullptr);
     s_instance = this;
     m_nodeModel.start();
+
+    if (const auto stallThreshold = m_settings.getUiStallThresholdMs(); stallThreshold > 0)
+    {
+        m_uiWatchdog = std::make_unique<UiWatchdog>(stallThreshold);
+    }
 }
 
 AppModel::~AppModel()
@@ -306,6 +311,10 @@ void AppModel::onResetWallet()
 {
     m_walletConnections.disconnect();
 
+    assert(m_rates);
+    assert(m_rates.use_count() == 1);
+    m_rates.reset();
+
     assert(m_assets);
     assert(m_assets.use_count() == 1);
     m_assets.reset();
@@ -470,7 +479,9 @@ void AppModel::start()
     initSwapClients();
 
     m_wallet = std::make_shared<WalletModel>(m_db, nodeAddrStr, m_walletReactor);
-    m_assets = std::make_shared<AssetsManager>(m_wallet);
+    m_wallet->setChangesCoalescing(m_settings.isChangesCoalescingEnabled());
+    m_assets = std::make_shared<AssetsManager>(m_wallet, QString::fromStdString(m_settings.getWalletFolder() + "/" + WalletSettings::AssetsCacheFile));
+    m_rates = std::make_shared<ExchangeRatesManager>(m_wallet, m_settings);
 
     if (m_settings.getRunLocalNode())
     {
@@ -520,6 +531,11 @@ AssetsManager::Ptr AppModel::getAssets() const
     return m_assets;
 }
 
+ExchangeRatesManager::Ptr AppModel::getRates() const
+{
+    return m_rates;
+}
+
 MessageManager& AppModel::getMessages()
 {
     return m_messages;
@@ -530,6 +546,11 @@ NodeModel& AppModel::getNode()
     return m_nodeModel;
 }
 
+UiWatchdog* AppModel::getUiWatchdog() const
+{
+    return m_uiWatchdog.get();
+}
+
 SwapCoinClientModel::Ptr AppModel::getSwapCoinClient(beam::wallet::AtomicSwapCoin swapCoin) const
 {
     auto it = m_swapClients.find(swapCoin);
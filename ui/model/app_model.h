@@ -18,12 +18,14 @@
 #include "settings.h"
 #include "messages.h"
 #include "node_model.h"
+#include "ui_watchdog.h"
 #include "helpers.h"
 #include "wallet/core/secstring.h"
 #include "wallet/core/private_key_keeper.h"
 #include "wallet/transactions/swaps/bridges/bitcoin/bridge_holder.h"
 #include "wallet/transactions/swaps/swap_transaction.h"
 #include "viewmodel/wallet/assets_manager.h"
+#include "viewmodel/notifications/exchange_rates_manager.h"
 #include <memory>
 
 #if defined(BEAM_HW_WALLET)
@@ -64,6 +66,7 @@ public:
 
     [[nodiscard]] WalletModel::Ptr getWalletModel() const;
     [[nodiscard]] AssetsManager::Ptr getAssets() const;
+    [[nodiscard]] ExchangeRatesManager::Ptr getRates() const;
     [[nodiscard]] WalletSettings& getSettings() const;
 
     MessageManager& getMessages();
@@ -73,6 +76,8 @@ public:
     [[nodiscard]] beam::wallet::IWalletDB::Ptr getWalletDB() const;
 
     NodeModel& getNode();
+    // Null if disabled in settings
+    UiWatchdog* getUiWatchdog() const;
     [[nodiscard]] SwapCoinClientModel::Ptr getSwapCoinClient(beam::wallet::AtomicSwapCoin swapCoin) const;
 
 public slots:
@@ -108,6 +113,7 @@ private:
     NodeModel m_nodeModel;
     WalletSettings& m_settings;
     AssetsManager::Ptr m_assets;
+    ExchangeRatesManager::Ptr m_rates;
     MessageManager m_messages;
     ECC::NoLeak<ECC::uintBig> m_passwordHash;
     beam::io::Reactor::Ptr m_walletReactor;
@@ -116,6 +122,7 @@ private:
     Connections m_walletConnections;
     static AppModel* s_instance;
     std::string m_walletDBBackupPath;
+    std::unique_ptr<UiWatchdog> m_uiWatchdog;
 
 #if defined(BEAM_HW_WALLET)
     mutable std::shared_ptr<beam::wallet::HWWallet> m_hwWallet;
@@ -0,0 +1,208 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include "wallet/client/wallet_client.h"
+
+#include <boost/optional.hpp>
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace beamui
+{
+
+//
+// Collects change notifications of one entity type and merges them by key,
+// so a burst of callbacks is delivered as a single batch per action.
+// Reset replaces everything collected before it, changes which follow
+// the reset are applied to the snapshot and delivered as a single Reset.
+//
+template <typename T, typename Key>
+class ChangeBatch
+{
+public:
+    using ChangeAction = beam::wallet::ChangeAction;
+    using GetKey = std::function<Key(const T&)>;
+
+    explicit ChangeBatch(GetKey getKey)
+        : m_getKey(std::move(getKey))
+    {
+    }
+
+    bool empty() const
+    {
+        return !m_reset && m_changes.empty();
+    }
+
+    void add(ChangeAction action, const std::vector<T>& items)
+    {
+        if (action == ChangeAction::Reset)
+        {
+            m_changes.clear();
+            m_keys.clear();
+            m_reset = true;
+        }
+
+        for (const auto& item : items)
+        {
+            merge(action, item);
+        }
+    }
+
+    // Calls @deliver(action, items) for every non-empty resulting batch and clears the batch
+    template <typename Deliver>
+    void flush(Deliver&& deliver)
+    {
+        if (m_reset)
+        {
+            std::vector<T> snapshot;
+            snapshot.reserve(m_changes.size());
+            for (auto& change : m_changes)
+            {
+                if (change.alive)
+                {
+                    snapshot.push_back(std::move(change.item));
+                }
+            }
+            clear();
+            deliver(ChangeAction::Reset, snapshot);
+            return;
+        }
+
+        std::vector<T> removed, updated, added;
+        for (auto& change : m_changes)
+        {
+            if (!change.alive)
+            {
+                continue;
+            }
+
+            switch (change.action)
+            {
+            case ChangeAction::Removed:
+                removed.push_back(std::move(change.item));
+                break;
+            case ChangeAction::Updated:
+                updated.push_back(std::move(change.item));
+                break;
+            default:
+                added.push_back(std::move(change.item));
+                break;
+            }
+        }
+        clear();
+
+        if (!removed.empty())
+        {
+            deliver(ChangeAction::Removed, removed);
+        }
+        if (!updated.empty())
+        {
+            deliver(ChangeAction::Updated, updated);
+        }
+        if (!added.empty())
+        {
+            deliver(ChangeAction::Added, added);
+        }
+    }
+
+private:
+    struct Change
+    {
+        ChangeAction action;
+        T item;
+        bool alive;
+    };
+
+    void clear()
+    {
+        m_changes.clear();
+        m_keys.clear();
+        m_reset = false;
+    }
+
+    void merge(ChangeAction action, const T& item)
+    {
+        const auto key = m_getKey(item);
+        const auto it = m_keys.find(key);
+        if (it == m_keys.end())
+        {
+            const auto resulting = resultOf(boost::none, action);
+            m_keys.emplace(key, m_changes.size());
+            m_changes.push_back({ resulting ? *resulting : action, item, !!resulting });
+            return;
+        }
+
+        auto& change = m_changes[it->second];
+        const auto resulting = resultOf(change.alive ? boost::make_optional(change.action) : boost::none, action);
+        change.alive = !!resulting;
+        if (resulting)
+        {
+            change.action = *resulting;
+            change.item = item;
+        }
+    }
+
+    // Combines previously collected action with the new one, none means the item
+    // is not visible to the UI side after both changes
+    boost::optional<ChangeAction> resultOf(boost::optional<ChangeAction> prev, ChangeAction next) const
+    {
+        if (m_reset)
+        {
+            // snapshot keeps only existing items
+            if (next == ChangeAction::Removed)
+            {
+                return boost::none;
+            }
+            return ChangeAction::Added;
+        }
+
+        if (!prev)
+        {
+            return next;
+        }
+
+        switch (*prev)
+        {
+        case ChangeAction::Added:
+            if (next == ChangeAction::Removed)
+            {
+                return boost::none;
+            }
+            return ChangeAction::Added;
+
+        case ChangeAction::Removed:
+            if (next == ChangeAction::Removed)
+            {
+                return ChangeAction::Removed;
+            }
+            return ChangeAction::Updated;
+
+        default:
+            if (next == ChangeAction::Removed)
+            {
+                return ChangeAction::Removed;
+            }
+            return ChangeAction::Updated;
+        }
+    }
+
+    GetKey m_getKey;
+    std::vector<Change> m_changes;
+    std::map<Key, size_t> m_keys;
+    bool m_reset = false;
+};
+
+}  // namespace beamui
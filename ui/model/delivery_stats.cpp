@@ -0,0 +1,124 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "delivery_stats.h"
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace beamui
+{
+    void LatencyHistogram::add(uint64_t us)
+    {
+        size_t bucket = 0;
+        while (bucket + 1 < kBuckets && (uint64_t(1) << bucket) < us)
+        {
+            ++bucket;
+        }
+        ++m_buckets[bucket];
+        ++m_count;
+        m_max = std::max(m_max, us);
+    }
+
+    uint64_t LatencyHistogram::getCount() const
+    {
+        return m_count;
+    }
+
+    uint64_t LatencyHistogram::getMax() const
+    {
+        return m_max;
+    }
+
+    uint64_t LatencyHistogram::getPercentile(double percent) const
+    {
+        if (!m_count)
+        {
+            return 0;
+        }
+
+        const auto target = static_cast<uint64_t>(m_count * percent / 100.0 + 0.5);
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < kBuckets; ++bucket)
+        {
+            seen += m_buckets[bucket];
+            if (seen >= target && seen)
+            {
+                return std::min(m_max, uint64_t(1) << bucket);
+            }
+        }
+        return m_max;
+    }
+
+    int64_t DeliveryStats::now()
+    {
+        using namespace std::chrono;
+        return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    void DeliveryStats::addQueueLatency(const char* name, int64_t sentAt)
+    {
+        getEntry(name).queue.add(static_cast<uint64_t>(std::max<int64_t>(0, now() - sentAt)));
+    }
+
+    void DeliveryStats::addHandlerTime(const char* name, int64_t startedAt)
+    {
+        getEntry(name).handler.add(static_cast<uint64_t>(std::max<int64_t>(0, now() - startedAt)));
+    }
+
+    std::vector<DeliveryStats::Entry> DeliveryStats::getEntries() const
+    {
+        std::vector<Entry> entries;
+        entries.reserve(m_entries.size());
+        for (const auto& p : m_entries)
+        {
+            entries.push_back(p.second);
+        }
+        return entries;
+    }
+
+    bool DeliveryStats::empty() const
+    {
+        return m_entries.empty();
+    }
+
+    void DeliveryStats::clear()
+    {
+        m_entries.clear();
+    }
+
+    std::string DeliveryStats::toString() const
+    {
+        std::ostringstream ss;
+        for (const auto& p : m_entries)
+        {
+            const auto& e = p.second;
+            ss << e.name << "[n=" << e.queue.getCount() << "/" << e.handler.getCount()
+               << " queue us p50/p95/max=" << e.queue.getPercentile(50) << "/" << e.queue.getPercentile(95) << "/" << e.queue.getMax()
+               << " handler us p50/p95/max=" << e.handler.getPercentile(50) << "/" << e.handler.getPercentile(95) << "/" << e.handler.getMax()
+               << "] ";
+        }
+        return ss.str();
+    }
+
+    DeliveryStats::Entry& DeliveryStats::getEntry(const char* name)
+    {
+        auto it = m_entries.find(name);
+        if (it == m_entries.end())
+        {
+            it = m_entries.emplace(name, Entry{ name, {}, {} }).first;
+        }
+        return it->second;
+    }
+}  // namespace beamui
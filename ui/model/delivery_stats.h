@@ -0,0 +1,77 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace beamui
+{
+    //
+    // Latency histogram with power of two buckets in microseconds
+    //
+    class LatencyHistogram
+    {
+    public:
+        static constexpr size_t kBuckets = 28; // up to ~2 minutes
+
+        void add(uint64_t us);
+        uint64_t getCount() const;
+        uint64_t getMax() const;
+        // Upper bound of the bucket which holds @percent of the samples
+        uint64_t getPercentile(double percent) const;
+
+    private:
+        std::array<uint64_t, kBuckets> m_buckets = {};
+        uint64_t m_count = 0;
+        uint64_t m_max = 0;
+    };
+
+    //
+    // Delivery times of the wallet callbacks: queue latency is the time from the reactor
+    // callback to the start of the UI thread handler, handler time is how long UI
+    // subscribers of the resulting signal took. Used on the UI thread only.
+    //
+    class DeliveryStats
+    {
+    public:
+        struct Entry
+        {
+            std::string name;
+            LatencyHistogram queue;
+            LatencyHistogram handler;
+        };
+
+        // Monotonic time in microseconds, taken on the reactor thread for the callbacks
+        static int64_t now();
+
+        void addQueueLatency(const char* name, int64_t sentAt);
+        void addHandlerTime(const char* name, int64_t startedAt);
+
+        std::vector<Entry> getEntries() const;
+        bool empty() const;
+        void clear();
+
+        // Single line summary with p50/p95/max per signal
+        std::string toString() const;
+
+    private:
+        Entry& getEntry(const char* name);
+
+        std::map<std::string, Entry> m_entries;
+    };
+}  // namespace beamui
@@ -13,8 +13,10 @@
 // limitations under the License.
 #pragma once
 
+#include <numeric>
 #include <vector>
 #include <QObject>
+#include "wallet/core/common.h"
 
 class Connections {
 public:
@@ -44,6 +46,11 @@ inline QString str2qstr(const std::string& str) {
     return QString::fromStdString(str);
 }
 
+// Empty string for zero id
+inline QString walletID2qstr(const beam::wallet::WalletID& walletID) {
+    return walletID != beam::Zero ? QString::fromStdString(std::to_string(walletID)) : QString();
+}
+
 inline std::string vec2str(const std::vector<std::string>& vec, char separator)
 {
     return std::accumulate(
@@ -13,6 +13,7 @@
 // limitations under the License
 
 #include "qr.h"
+#include "ui_watchdog.h"
 
 #include <QUrlQuery>
 #include <QtGui/qimage.h>
@@ -83,6 +84,7 @@ const QString& QR::getEncoded() const
 
 void QR::update()
 {
+    UiWatchdog::Activity activity("QR::update");
     QUrlQuery query;
     if (m_amountGrothes > 0)
     {
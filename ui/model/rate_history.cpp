@@ -0,0 +1,165 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rate_history.h"
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QSaveFile>
+#include "utility/logger.h"
+
+using namespace beam::wallet;
+
+namespace
+{
+    const quint32 kHistoryVersion = 1;
+    const beam::Timestamp kBucketSeconds = 60 * 60;
+    const uint32_t kMaxLookbackBuckets = 24;
+
+    uint32_t toBucket(beam::Timestamp time)
+    {
+        return static_cast<uint32_t>(time / kBucketSeconds);
+    }
+}  // namespace
+
+RateHistory::RateHistory(const QString& filePath)
+    : m_filePath(filePath)
+{
+}
+
+void RateHistory::load()
+{
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    // version followed by records of currency, unit, bucket and rate
+    QDataStream stream(&file);
+    quint32 version = 0;
+    stream >> version;
+    bool rewrite = false;
+    if (stream.status() != QDataStream::Ok || version != kHistoryVersion)
+    {
+        LOG_WARNING() << "Unsupported exchange rates history, starting a new one: " << m_filePath.toStdString();
+        rewrite = true;
+    }
+    else
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!stream.atEnd())
+        {
+            quint32 currency = 0, unit = 0, bucket = 0;
+            quint64 rate = 0;
+            stream >> currency >> unit >> bucket >> rate;
+            if (stream.status() != QDataStream::Ok)
+            {
+                LOG_WARNING() << "Exchange rates history is truncated: " << m_filePath.toStdString();
+                rewrite = true;
+                break;
+            }
+            m_rates.emplace(Key(currency, unit, bucket), rate);
+        }
+    }
+    file.close();
+
+    if (rewrite)
+    {
+        // later records are appended, so the file should end with a whole record
+        save();
+    }
+}
+
+void RateHistory::save() const
+{
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        LOG_WARNING() << "Failed to write exchange rates history: " << m_filePath.toStdString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << kHistoryVersion;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (const auto& p : m_rates)
+        {
+            stream << quint32(std::get<0>(p.first)) << quint32(std::get<1>(p.first)) << quint32(std::get<2>(p.first)) << quint64(p.second);
+        }
+    }
+    file.commit();
+}
+
+void RateHistory::add(const std::vector<ExchangeRate>& rates)
+{
+    std::vector<std::pair<Key, beam::Amount>> added;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (const auto& rate : rates)
+        {
+            const auto time = rate.m_updateTime ? rate.m_updateTime : static_cast<beam::Timestamp>(QDateTime::currentSecsSinceEpoch());
+            const Key key(static_cast<uint32_t>(rate.m_currency), static_cast<uint32_t>(rate.m_unit), toBucket(time));
+            if (m_rates.emplace(key, rate.m_rate).second)
+            {
+                added.emplace_back(key, rate.m_rate);
+            }
+        }
+    }
+
+    if (added.empty())
+    {
+        return;
+    }
+
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        LOG_WARNING() << "Failed to write exchange rates history: " << m_filePath.toStdString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    if (file.size() == 0)
+    {
+        stream << kHistoryVersion;
+    }
+    for (const auto& p : added)
+    {
+        stream << quint32(std::get<0>(p.first)) << quint32(std::get<1>(p.first)) << quint32(std::get<2>(p.first)) << quint64(p.second);
+    }
+}
+
+beam::Amount RateHistory::getRate(Currency currency, Currency unit, beam::Timestamp time) const
+{
+    const auto bucket = toBucket(time);
+    const Key key(static_cast<uint32_t>(currency), static_cast<uint32_t>(unit), bucket);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_rates.upper_bound(key);
+    if (it == m_rates.begin())
+    {
+        return 0;
+    }
+
+    --it;
+    const auto& found = it->first;
+    if (std::get<0>(found) != std::get<0>(key) || std::get<1>(found) != std::get<1>(key) ||
+        bucket - std::get<2>(found) > kMaxLookbackBuckets)
+    {
+        return 0;
+    }
+    return it->second;
+}
@@ -0,0 +1,56 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include "wallet/client/extensions/news_channels/interface.h"
+
+//
+// Exchange rates history in hourly buckets, the first rate received in a bucket is kept.
+// Stored in a versioned append only file next to the wallet database, one record per
+// currency pair and hour, so it grows slowly and is not compacted. Lookups are thread safe,
+// transaction objects read it from the thread pool.
+//
+class RateHistory
+{
+public:
+    using Ptr = std::shared_ptr<RateHistory>;
+    using Currency = beam::wallet::ExchangeRate::Currency;
+
+    explicit RateHistory(const QString& filePath);
+
+    // Loads the stored history, called once before use
+    void load();
+    // Adds rates for the buckets not known yet and appends them to the file
+    void add(const std::vector<beam::wallet::ExchangeRate>& rates);
+
+    // Rate in the bucket of @time or in the closest earlier one within a day, 0 if unknown
+    beam::Amount getRate(Currency currency, Currency unit, beam::Timestamp time) const;
+
+private:
+    // Rewrites the file with the stored rates
+    void save() const;
+
+    // currency, unit, bucket
+    using Key = std::tuple<uint32_t, uint32_t, uint32_t>;
+
+    const QString m_filePath;
+    mutable std::mutex m_mutex;
+    std::map<Key, beam::Amount> m_rates;
+};
@@ -41,6 +41,9 @@ namespace
     const char* kIsAlowedBeamMWLink = "beam_mw_links_allowed";
     const char* kshowSwapBetaWarning = "show_swap_beta_warning";
     const char* kRateUnit = "rateUnit";
+    const char* kCoalesceChanges = "ui/coalesce_changes";
+    const char* kUiStallThresholdMs = "ui/stall_threshold_ms";
+    const int kDefaultUiStallThresholdMs = 500;
 
     const char* kLocalNodeRun = "localnode/run";
     const char* kLocalNodePort = "localnode/port";
@@ -58,6 +61,7 @@ namespace
     const char* kDevAppName = "devapp/name";
 
     const char* kMpAnonymitySet = "max_privacy/anonymity_set";
+    const char* kShieldedCountSamples = "max_privacy/shielded_count_samples";
 
     const std::map<QString, QString> kSupportedLangs { 
         { "zh_CN", "Chinese Simplified"},
@@ -105,6 +109,8 @@ const char* WalletSettings::WalletDBFile = "wallet.db";
 const char* WalletSettings::TrezorWalletDBFile = "trezor-wallet.db";
 #endif
 const char* WalletSettings::NodeDBFile = "node.db";
+const char* WalletSettings::RateHistoryFile = "rates_history.dat";
+const char* WalletSettings::AssetsCacheFile = "assets_cache.dat";
 
 WalletSettings::WalletSettings(const QDir& appDataDir)
     : m_data{ appDataDir.filePath(SettingsFile), QSettings::IniFormat }
@@ -215,6 +221,24 @@ void WalletSettings::setAllowedBeamMWLinks(bool value)
     emit beamMWLinksChanged();
 }
 
+bool WalletSettings::isChangesCoalescingEnabled() const
+{
+    Lock lock(m_mutex);
+    return m_data.value(kCoalesceChanges, false).toBool();
+}
+
+void WalletSettings::setChangesCoalescingEnabled(bool value)
+{
+    Lock lock(m_mutex);
+    m_data.setValue(kCoalesceChanges, value);
+}
+
+int WalletSettings::getUiStallThresholdMs() const
+{
+    Lock lock(m_mutex);
+    return m_data.value(kUiStallThresholdMs, kDefaultUiStallThresholdMs).toInt();
+}
+
 bool WalletSettings::showSwapBetaWarning()
 {
     Lock lock(m_mutex);
@@ -519,8 +543,42 @@ void WalletSettings::setMaxPrivacyLockTimeLimitHours(uint8_t lockTimeLimit)
                 m_mpLockTimeLimit = lockTimeLimit;
             }
             walletModel->getAsync()->setMaxPrivacyLockTimeLimitHours(lockTimeLimit);
+            walletModel->refreshMPLockTimeLimit();
+        }
+    }
+}
+
+std::map<beam::Height, beam::TxoID> WalletSettings::getShieldedCountSamples() const
+{
+    std::map<beam::Height, beam::TxoID> samples;
+    Lock lock(m_mutex);
+    // stored as "height:count" pairs
+    for (const auto& sample : m_data.value(kShieldedCountSamples).toStringList())
+    {
+        const auto parts = sample.split(':');
+        bool heightOk = false, countOk = false;
+        if (parts.size() == 2)
+        {
+            const auto height = parts[0].toULongLong(&heightOk);
+            const auto count = parts[1].toULongLong(&countOk);
+            if (heightOk && countOk)
+            {
+                samples.emplace(height, count);
+            }
         }
     }
+    return samples;
+}
+
+void WalletSettings::setShieldedCountSamples(const std::map<beam::Height, beam::TxoID>& samples)
+{
+    QStringList value;
+    for (const auto& p : samples)
+    {
+        value.push_back(QString("%1:%2").arg(p.first).arg(p.second));
+    }
+    Lock lock(m_mutex);
+    m_data.setValue(kShieldedCountSamples, value);
 }
 
 // static
@@ -18,6 +18,7 @@
 #include <QSettings>
 #include <QDir>
 #include <QStringList>
+#include <map>
 #include <mutex>
 #include "model/wallet_model.h"
 
@@ -43,6 +44,13 @@ public:
     bool showSwapBetaWarning();
     void setShowSwapBetaWarning(bool value);
 
+    // Merge wallet change notifications over a short window, applied on the next wallet start
+    bool isChangesCoalescingEnabled() const;
+    void setChangesCoalescingEnabled(bool value);
+
+    // UI event loop stall reported by the watchdog, 0 disables the watchdog. Applied on restart
+    int getUiStallThresholdMs() const;
+
 #if defined(BEAM_HW_WALLET)
     std::string getTrezorWalletStorage() const;
 #endif
@@ -95,6 +103,10 @@ public:
     uint8_t getMaxPrivacyLockTimeLimitHours() const;
     void setMaxPrivacyLockTimeLimitHours(uint8_t lockTimeLimit);
 
+    // Shielded outputs count at past heights, kept for the 24h shielded rate estimate
+    std::map<beam::Height, beam::TxoID> getShieldedCountSamples() const;
+    void setShieldedCountSamples(const std::map<beam::Height, beam::TxoID>& samples);
+
     QString getExplorerUrl() const;
     QString getFaucetUrl() const;
     QString getAppsUrl() const;
@@ -108,6 +120,8 @@ public:
     static const char* TrezorWalletDBFile;
 #endif
     static const char* NodeDBFile;
+    static const char* RateHistoryFile;
+    static const char* AssetsCacheFile;
 
     void applyChanges();
 
@@ -0,0 +1,197 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tx_row.h"
+#include "helpers.h"
+#include "wallet/core/simple_transaction.h"
+#include "bvm/ManagerStd.h"
+#include <algorithm>
+#include <map>
+
+using namespace beam;
+using namespace beam::wallet;
+
+namespace
+{
+    std::string getStatusText(const TxDescription& tx)
+    {
+        switch (tx.m_txType)
+        {
+        case TxType::Simple:
+            return SimpleTxStatusInterpreter(tx).getStatus();
+        case TxType::PushTransaction:
+            return MaxPrivacyTxStatusInterpreter(tx).getStatus();
+        case TxType::Contract:
+            return ContractTxStatusInterpreter(tx).getStatus();
+        case TxType::DexSimpleSwap:
+            // TODO:DEX implement
+            return "NOT IMPLEMENTED";
+        default:
+            break;
+        }
+
+        if (tx.m_txType >= TxType::AssetIssue && tx.m_txType <= TxType::AssetInfo)
+        {
+            return AssetTxStatusInterpreter(tx).getStatus();
+        }
+        return "unknown";
+    }
+
+    // Interpreters give the status as text only, it is coded here once per row,
+    // so UI thread never compares the texts
+    TxRow::Status getStatusCode(const TxDescription& tx)
+    {
+        static const std::map<std::string, TxRow::Status> kStatuses =
+        {
+            {"pending", TxRow::Status::Pending},
+            {"waiting for sender", TxRow::Status::WaitingForSender},
+            {"waiting for receiver", TxRow::Status::WaitingForReceiver},
+            {"in progress", TxRow::Status::InProgress},
+            {"sent to own address", TxRow::Status::SentToOwnAddress},
+            {"sending to own address", TxRow::Status::SendingToOwnAddress},
+            {"received", TxRow::Status::Received},
+            {"sent", TxRow::Status::Sent},
+            {"cancelled", TxRow::Status::Cancelled},
+            {"expired", TxRow::Status::Expired},
+            {"failed", TxRow::Status::Failed},
+            {"in progress max privacy", TxRow::Status::InProgressMaxPrivacy},
+            {"in progress offline", TxRow::Status::InProgressOffline},
+            {"in progress public offline", TxRow::Status::InProgressPublicOffline},
+            {"sent max privacy", TxRow::Status::SentMaxPrivacy},
+            {"sent offline", TxRow::Status::SentOffline},
+            {"sent public offline", TxRow::Status::SentPublicOffline},
+            {"received max privacy", TxRow::Status::ReceivedMaxPrivacy},
+            {"received offline", TxRow::Status::ReceivedOffline},
+            {"received public offline", TxRow::Status::ReceivedPublicOffline},
+            {"canceled max privacy", TxRow::Status::CanceledMaxPrivacy},
+            {"canceled offline", TxRow::Status::CanceledOffline},
+            {"canceled public offline", TxRow::Status::CanceledPublicOffline},
+            {"failed max privacy", TxRow::Status::FailedMaxPrivacy},
+            {"failed offline", TxRow::Status::FailedOffline},
+            {"failed public offline", TxRow::Status::FailedPublicOffline},
+            {"completed", TxRow::Status::Completed},
+        };
+
+        const auto it = kStatuses.find(getStatusText(tx));
+        return it != kStatuses.end() ? it->second : TxRow::Status::Unknown;
+    }
+
+    Height getHeightParameter(const TxDescription& tx, TxParameterID id)
+    {
+        auto value = tx.GetParameter<Height>(id);
+        return value ? *value : 0;
+    }
+}  // namespace
+
+TxRow::Ptr TxRow::fromDescription(const TxDescription& tx)
+{
+    auto row = std::make_shared<TxRow>();
+
+    row->txId = tx.m_txId;
+    row->txType = tx.m_txType;
+    row->status = tx.m_status;
+    row->failureReason = tx.m_failureReason;
+    row->createTime = tx.m_createTime;
+    row->modifyTime = tx.m_modifyTime;
+    row->assetId = tx.m_assetId;
+    row->amount = tx.m_amount;
+    row->sender = tx.m_sender;
+    row->income = !tx.m_sender;
+    row->selfTx = tx.m_selfTx;
+    row->canCancel = tx.canCancel();
+    row->canDelete = tx.canDelete();
+
+    if (tx.m_txType == TxType::Contract)
+    {
+        AmountSigned contractAmount = 0;
+        Amount contractFee = 0;
+        std::vector<bvm2::ContractInvokeData> vData;
+        if (tx.GetParameter(TxParameterID::ContractDataPacked, vData))
+        {
+            for (const auto& data: vData)
+            {
+                for (const auto& spend: data.m_Spend)
+                {
+                    row->assets.push_back(spend.first);
+                    // TODO: this potentially can overflow
+                    contractAmount -= spend.second;
+                    contractFee += data.m_Fee;
+                }
+            }
+        }
+
+        if (contractAmount > 0)
+        {
+            contractAmount -= contractFee;
+        }
+
+        std::sort(row->assets.begin(), row->assets.end());
+        row->assets.erase(std::unique(row->assets.begin(), row->assets.end()), row->assets.end());
+        row->amount = std::abs(contractAmount);
+        row->fee = contractFee;
+        row->income = contractAmount > 0;
+    }
+    else
+    {
+        row->assets.push_back(tx.m_assetId);
+        if (tx.m_fee)
+        {
+            row->fee = GetShieldedFee(tx) + tx.m_fee;
+        }
+    }
+
+    auto storedType = tx.GetParameter<TxAddressType>(TxParameterID::AddressType);
+    if (storedType)
+    {
+        row->addressType = *storedType;
+    }
+    else if (tx.m_sender)
+    {
+        row->addressType = GetAddressType(tx);
+    }
+
+    if (tx.m_assetId == Asset::s_BeamID)
+    {
+        auto rates = tx.GetParameter<std::vector<ExchangeRate>>(TxParameterID::ExchangeRates);
+        if (rates)
+        {
+            for (const auto& rate : *rates)
+            {
+                if (rate.m_currency == ExchangeRate::Currency::Beam)
+                {
+                    row->rates.push_back(rate);
+                }
+            }
+        }
+    }
+
+    row->minHeight = getHeightParameter(tx, TxParameterID::MinHeight);
+    row->peerResponseTime = getHeightParameter(tx, TxParameterID::PeerResponseTime);
+    row->maxHeight = getHeightParameter(tx, TxParameterID::MaxHeight);
+    row->lifetime = getHeightParameter(tx, TxParameterID::Lifetime);
+
+    std::string message{tx.m_message.begin(), tx.m_message.end()};
+    row->comment = QString(message.c_str()).trimmed();
+    row->txIdHex = QString::fromStdString(to_hex(tx.m_txId.data(), tx.m_txId.size()));
+    row->kernelID = QString::fromStdString(to_hex(tx.m_kernelID.m_pData, tx.m_kernelID.nBytes));
+    row->token = QString::fromStdString(tx.getToken());
+    row->senderIdentity = QString::fromStdString(tx.getSenderIdentity());
+    row->receiverIdentity = QString::fromStdString(tx.getReceiverIdentity());
+    row->statusCode = getStatusCode(tx);
+
+    row->myAddress = walletID2qstr(tx.m_myId);
+    row->peerAddress = walletID2qstr(tx.m_peerId);
+
+    return row;
+}
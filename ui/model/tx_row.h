@@ -0,0 +1,114 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <memory>
+#include <vector>
+
+#include "wallet/core/common.h"
+#include "wallet/client/extensions/news_channels/interface.h"
+
+//
+// Flat projection of a transaction with the fields the transactions table needs.
+// Built on the reactor thread, so tx parameters and contract data are decoded
+// there once, UI thread only reads the ready values. Immutable after creation.
+//
+struct TxRow
+{
+    using Ptr = std::shared_ptr<const TxRow>;
+
+    // Compact code of the status given by the tx status interpreters
+    enum class Status : uint8_t
+    {
+        Pending,
+        WaitingForSender,
+        WaitingForReceiver,
+        InProgress,
+        SentToOwnAddress,
+        SendingToOwnAddress,
+        Received,
+        Sent,
+        Cancelled,
+        Expired,
+        Failed,
+        InProgressMaxPrivacy,
+        InProgressOffline,
+        InProgressPublicOffline,
+        SentMaxPrivacy,
+        SentOffline,
+        SentPublicOffline,
+        ReceivedMaxPrivacy,
+        ReceivedOffline,
+        ReceivedPublicOffline,
+        CanceledMaxPrivacy,
+        CanceledOffline,
+        CanceledPublicOffline,
+        FailedMaxPrivacy,
+        FailedOffline,
+        FailedPublicOffline,
+        Completed,
+        Unknown,
+        Count
+    };
+
+    static Ptr fromDescription(const beam::wallet::TxDescription& tx);
+
+    // Snapshots carry no change marks, rows of the same transaction
+    // are compared by what the wallet updates on every change
+    bool isSameState(const TxRow& other) const
+    {
+        return modifyTime == other.modifyTime && status == other.status;
+    }
+
+    beam::wallet::TxID txId = {};
+    beam::wallet::TxType txType = beam::wallet::TxType::Simple;
+    beam::wallet::TxStatus status = beam::wallet::TxStatus::Pending;
+    beam::wallet::TxFailureReason failureReason = beam::wallet::TxFailureReason::Unknown;
+    beam::wallet::TxAddressType addressType = beam::wallet::TxAddressType::Unknown;
+    Status statusCode = Status::Unknown;
+    beam::Timestamp createTime = 0;
+    beam::Timestamp modifyTime = 0;
+
+    beam::Asset::ID assetId = beam::Asset::s_BeamID;
+    // for contracts: assets spent by the contract calls
+    std::vector<beam::Asset::ID> assets;
+    // absolute value, for contracts the sum of spends without fee
+    beam::Amount amount = 0;
+    // total fee including shielded part
+    beam::Amount fee = 0;
+    // Beam rates stored with the transaction
+    std::vector<beam::wallet::ExchangeRate> rates;
+
+    bool sender = false;
+    bool income = false;
+    bool selfTx = false;
+    bool canCancel = false;
+    bool canDelete = false;
+
+    // inputs of the state details text, 0 if parameter is not set
+    beam::Height minHeight = 0;
+    beam::Height peerResponseTime = 0;
+    beam::Height maxHeight = 0;
+    beam::Height lifetime = 0;
+
+    QString txIdHex;
+    QString kernelID;
+    QString comment;
+    QString myAddress;
+    QString peerAddress;
+    QString token;
+    QString senderIdentity;
+    QString receiverIdentity;
+};
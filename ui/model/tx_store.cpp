@@ -0,0 +1,269 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tx_store.h"
+#include "wallet_model.h"
+#include <set>
+
+using namespace beam::wallet;
+
+TxStore::TxStore(WalletModel& model)
+    : m_model(model)
+    , m_transactions(std::make_shared<std::vector<TxDescription>>())
+    , m_rows(std::make_shared<std::vector<TxRow::Ptr>>())
+{
+    connect(&m_model, &WalletModel::transactionRowsChanged, this, &TxStore::onTransactionRowsChanged);
+    connect(&m_model, &WalletModel::transactionsChanged, this, &TxStore::onTransactionsChanged);
+}
+
+void TxStore::getTransactions(QObject* receiver, Handler handler)
+{
+    if (!m_loaded)
+    {
+        load();
+        return;
+    }
+
+    // snapshot is taken on delivery, so deltas which come before it are not lost
+    QPointer<QObject> guard(receiver);
+    QMetaObject::invokeMethod(this, [this, guard, handler = std::move(handler)]()
+    {
+        if (guard)
+        {
+            // detach() copies the history if it is changed while the handler still uses it
+            beamui::SharedItems<TxDescription> snapshot = m_transactions;
+            handler(ChangeAction::Reset, *snapshot);
+        }
+    }, Qt::QueuedConnection);
+}
+
+void TxStore::getRows(QObject* receiver, RowsHandler handler)
+{
+    if (!m_loaded)
+    {
+        load();
+        return;
+    }
+
+    QPointer<QObject> guard(receiver);
+    QMetaObject::invokeMethod(this, [this, guard, handler = std::move(handler)]()
+    {
+        if (guard)
+        {
+            beamui::SharedItems<TxRow::Ptr> snapshot = m_rows;
+            handler(ChangeAction::Reset, *snapshot);
+        }
+    }, Qt::QueuedConnection);
+}
+
+bool TxStore::isLoaded() const
+{
+    return m_loaded;
+}
+
+TxRow::Ptr TxStore::getRow(const TxID& txId) const
+{
+    const auto it = m_index.find(txId);
+    return it != m_index.end() ? (*m_rows)[it->second] : TxRow::Ptr();
+}
+
+void TxStore::load()
+{
+    if (m_requested)
+    {
+        return;
+    }
+
+    m_requested = true;
+    m_model.getAsync()->getTransactions();
+}
+
+void TxStore::onTransactionRowsChanged(ChangeAction, const std::vector<TxRow::Ptr>& rows)
+{
+    // wallet model emits rows of the changes before their transactions, in the same order
+    m_incomingRows.push_back(rows);
+}
+
+void TxStore::onTransactionsChanged(ChangeAction action, const std::vector<TxDescription>& items)
+{
+    std::vector<TxRow::Ptr> rows;
+    if (!m_incomingRows.empty())
+    {
+        rows.swap(m_incomingRows.front());
+        m_incomingRows.pop_front();
+    }
+    assert(rows.size() == items.size());
+    if (rows.size() != items.size())
+    {
+        // should not happen, decode here rather than lose the change
+        rows.clear();
+        for (const auto& item : items)
+        {
+            rows.push_back(TxRow::fromDescription(item));
+        }
+    }
+
+    switch (action)
+    {
+        case ChangeAction::Reset:
+            applySnapshot(items, rows);
+            break;
+
+        case ChangeAction::Added:
+        case ChangeAction::Updated:
+        case ChangeAction::Removed:
+            applyChanges(action, items, rows);
+            notify(action, items, rows);
+            break;
+
+        default:
+            assert(false && "Unexpected action");
+            break;
+    }
+}
+
+void TxStore::applySnapshot(const std::vector<TxDescription>& items, const std::vector<TxRow::Ptr>& rows)
+{
+    m_requested = false;
+
+    if (!m_loaded)
+    {
+        m_loaded = true;
+        setTransactions(items, rows);
+        notify(ChangeAction::Reset, items, rows);
+        return;
+    }
+
+    // subscribers already have the history, send them the difference.
+    // Transactions which are not modified since the stored snapshot are not passed
+    std::set<TxID> present;
+    std::vector<TxDescription> added;
+    std::vector<TxRow::Ptr> addedRows;
+    std::vector<TxDescription> updated;
+    std::vector<TxRow::Ptr> updatedRows;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        present.insert(items[i].m_txId);
+        const auto it = m_index.find(items[i].m_txId);
+        if (it == m_index.end())
+        {
+            added.push_back(items[i]);
+            addedRows.push_back(rows[i]);
+        }
+        else if (!(*m_rows)[it->second]->isSameState(*rows[i]))
+        {
+            updated.push_back(items[i]);
+            updatedRows.push_back(rows[i]);
+        }
+    }
+
+    std::vector<TxDescription> removed;
+    std::vector<TxRow::Ptr> removedRows;
+    for (const auto& p : m_index)
+    {
+        if (present.find(p.first) == present.end())
+        {
+            removed.push_back((*m_transactions)[p.second]);
+            removedRows.push_back((*m_rows)[p.second]);
+        }
+    }
+
+    setTransactions(items, rows);
+
+    if (!removed.empty())
+    {
+        notify(ChangeAction::Removed, removed, removedRows);
+    }
+    if (!updated.empty())
+    {
+        notify(ChangeAction::Updated, updated, updatedRows);
+    }
+    if (!added.empty())
+    {
+        notify(ChangeAction::Added, added, addedRows);
+    }
+}
+
+void TxStore::applyChanges(ChangeAction action, const std::vector<TxDescription>& items, const std::vector<TxRow::Ptr>& rows)
+{
+    detach();
+    auto& transactions = *m_transactions;
+    auto& storedRows = *m_rows;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        const auto& item = items[i];
+        const auto it = m_index.find(item.m_txId);
+        if (action != ChangeAction::Removed)
+        {
+            if (it != m_index.end())
+            {
+                transactions[it->second] = item;
+                storedRows[it->second] = rows[i];
+            }
+            else
+            {
+                m_index.emplace(item.m_txId, transactions.size());
+                transactions.push_back(item);
+                storedRows.push_back(rows[i]);
+            }
+            continue;
+        }
+
+        if (it == m_index.end())
+        {
+            continue;
+        }
+
+        // order is not kept, the last transaction takes the place of the removed one
+        const auto pos = it->second;
+        m_index.erase(it);
+        if (pos + 1 != transactions.size())
+        {
+            transactions[pos] = std::move(transactions.back());
+            storedRows[pos] = std::move(storedRows.back());
+            m_index[transactions[pos].m_txId] = pos;
+        }
+        transactions.pop_back();
+        storedRows.pop_back();
+    }
+}
+
+void TxStore::setTransactions(const std::vector<TxDescription>& items, const std::vector<TxRow::Ptr>& rows)
+{
+    m_transactions = std::make_shared<std::vector<TxDescription>>(items);
+    m_rows = std::make_shared<std::vector<TxRow::Ptr>>(rows);
+    m_index.clear();
+    for (size_t i = 0; i < m_transactions->size(); ++i)
+    {
+        m_index[(*m_transactions)[i].m_txId] = i;
+    }
+}
+
+void TxStore::notify(ChangeAction action, const std::vector<TxDescription>& items, const std::vector<TxRow::Ptr>& rows)
+{
+    emit rowsChanged(action, rows);
+    emit transactionsChanged(action, items);
+}
+
+void TxStore::detach()
+{
+    if (m_transactions.use_count() > 1)
+    {
+        m_transactions = std::make_shared<std::vector<TxDescription>>(*m_transactions);
+    }
+    if (m_rows.use_count() > 1)
+    {
+        m_rows = std::make_shared<std::vector<TxRow::Ptr>>(*m_rows);
+    }
+}
@@ -0,0 +1,106 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <QPointer>
+#include <deque>
+#include <functional>
+#include <map>
+
+#include "wallet/client/wallet_client.h"
+#include "tx_row.h"
+
+class WalletModel;
+
+//
+// UI side copy of the transactions history shared by all views.
+// History is requested from the wallet once, views which subscribe later
+// get the stored snapshot, after that everyone receives the same deltas.
+// Snapshots are not copied, late subscribers get the stored vectors themselves.
+// Every transaction is kept with its row projected on the reactor thread,
+// views which need table fields only subscribe to the rows.
+//
+class TxStore : public QObject
+{
+    Q_OBJECT
+public:
+    using Handler = std::function<void(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)>;
+    using RowsHandler = std::function<void(beam::wallet::ChangeAction, const std::vector<TxRow::Ptr>&)>;
+
+    explicit TxStore(WalletModel& model);
+
+    // Connects @slot to transactionsChanged and delivers the current history to it as Reset
+    template <typename Receiver>
+    QMetaObject::Connection subscribe(Receiver* receiver, void (Receiver::*slot)(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&))
+    {
+        auto connection = connect(this, &TxStore::transactionsChanged, receiver, slot);
+        getTransactions(receiver, [receiver, slot](beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+        {
+            (receiver->*slot)(action, items);
+        });
+        return connection;
+    }
+
+    // Connects @slot to rowsChanged and delivers rows of the current history to it as Reset
+    template <typename Receiver>
+    QMetaObject::Connection subscribe(Receiver* receiver, void (Receiver::*slot)(beam::wallet::ChangeAction, const std::vector<TxRow::Ptr>&))
+    {
+        auto connection = connect(this, &TxStore::rowsChanged, receiver, slot);
+        getRows(receiver, [receiver, slot](beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& rows)
+        {
+            (receiver->*slot)(action, rows);
+        });
+        return connection;
+    }
+
+    // Calls @handler with the whole history as Reset on the next event loop iteration.
+    // If history is not loaded yet, it is requested (once for all callers) and
+    // delivered to subscribers with transactionsChanged instead.
+    void getTransactions(QObject* receiver, Handler handler);
+    // Same as getTransactions() for the rows
+    void getRows(QObject* receiver, RowsHandler handler);
+    bool isLoaded() const;
+    // Projection of the stored transaction, null if it is unknown
+    TxRow::Ptr getRow(const beam::wallet::TxID& txId) const;
+
+signals:
+    // Rows of the same change, emitted right before transactionsChanged
+    void rowsChanged(beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& rows);
+    void transactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+
+private slots:
+    void onTransactionRowsChanged(beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& rows);
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+
+private:
+    void load();
+    void applySnapshot(const std::vector<beam::wallet::TxDescription>& items, const std::vector<TxRow::Ptr>& rows);
+    void applyChanges(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items, const std::vector<TxRow::Ptr>& rows);
+    void setTransactions(const std::vector<beam::wallet::TxDescription>& items, const std::vector<TxRow::Ptr>& rows);
+    void notify(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items, const std::vector<TxRow::Ptr>& rows);
+    // Copies stored vectors only if a snapshot which is being delivered still holds them
+    void detach();
+
+    WalletModel& m_model;
+    // unordered, shared read-only with the snapshots being delivered, m_rows[i] is the row of m_transactions[i]
+    std::shared_ptr<std::vector<beam::wallet::TxDescription>> m_transactions;
+    std::shared_ptr<std::vector<TxRow::Ptr>> m_rows;
+    // tx id -> position in m_transactions and m_rows
+    std::map<beam::wallet::TxID, size_t> m_index;
+    // rows of the changes which are delivered next with transactionsChanged, in the same order
+    std::deque<std::vector<TxRow::Ptr>> m_incomingRows;
+    bool m_loaded = false;
+    bool m_requested = false;
+};
@@ -0,0 +1,201 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ui_watchdog.h"
+#include <QCoreApplication>
+#include <QEvent>
+#include <QMetaMethod>
+#include <QThread>
+#include <QtCore/private/qobject_p.h>
+#include <chrono>
+#include "utility/logger.h"
+
+namespace
+{
+    const int kBeatIntervalMs = 100;
+    const size_t kMaxStalls = 50;
+
+    // Slot of the queued call, null for calls of functors. Names are kept in the static data
+    // of meta objects, so they can be read from the watchdog thread
+    const char* getSlotName(const QObject* receiver, const QEvent* event)
+    {
+        if (event->type() != QEvent::MetaCall)
+        {
+            return nullptr;
+        }
+
+        const auto* call = dynamic_cast<const QMetaCallEvent*>(event);
+        if (!call)
+        {
+            return nullptr;
+        }
+
+        const auto* meta = receiver->metaObject();
+        const auto id = call->id();
+        if (id < 0 || id >= meta->methodCount())
+        {
+            return nullptr;
+        }
+        return meta->method(id).name().constData();
+    }
+}  // namespace
+
+std::atomic<const char*> UiWatchdog::s_activity{nullptr};
+std::atomic<const char*> UiWatchdog::s_eventReceiver{nullptr};
+std::atomic<const char*> UiWatchdog::s_eventSlot{nullptr};
+std::atomic<int> UiWatchdog::s_eventType{0};
+std::atomic<const QObject*> UiWatchdog::s_beatTimer{nullptr};
+
+UiWatchdog::Activity::Activity(const char* name)
+    : m_prev(s_activity.exchange(name))
+{
+}
+
+UiWatchdog::Activity::~Activity()
+{
+    s_activity = m_prev;
+}
+
+UiWatchdog::Delivery::Delivery(const QObject* receiver, const QEvent* event)
+{
+    // the timer is only compared, it can be destroyed while other threads deliver their events
+    const QObject* beatTimer = s_beatTimer;
+    if (!beatTimer || receiver == beatTimer || receiver->thread() != QCoreApplication::instance()->thread())
+    {
+        return;
+    }
+
+    // class names are static strings, so they can be read from the watchdog thread
+    m_marked = true;
+    m_prevReceiver = s_eventReceiver.exchange(receiver->metaObject()->className());
+    m_prevSlot = s_eventSlot.exchange(getSlotName(receiver, event));
+    m_prevType = s_eventType.exchange(static_cast<int>(event->type()));
+}
+
+UiWatchdog::Delivery::~Delivery()
+{
+    if (m_marked)
+    {
+        s_eventReceiver = m_prevReceiver;
+        s_eventSlot = m_prevSlot;
+        s_eventType = m_prevType;
+    }
+}
+
+UiWatchdog::UiWatchdog(int thresholdMs)
+    : m_thresholdMs(thresholdMs)
+    , m_lastBeat(now())
+{
+    m_beatTimer.setInterval(kBeatIntervalMs);
+    connect(&m_beatTimer, &QTimer::timeout, this, &UiWatchdog::onBeat);
+    m_beatTimer.start();
+    s_beatTimer = &m_beatTimer;
+
+    m_thread = std::thread([this] () { run(); });
+}
+
+UiWatchdog::~UiWatchdog()
+{
+    s_beatTimer = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_stopCondition.notify_one();
+    m_thread.join();
+}
+
+int UiWatchdog::getThresholdMs() const
+{
+    return m_thresholdMs;
+}
+
+const std::deque<UiWatchdog::Stall>& UiWatchdog::getStalls() const
+{
+    return m_stalls;
+}
+
+void UiWatchdog::onBeat()
+{
+    const auto beat = now();
+    const auto lastBeat = m_lastBeat.exchange(beat);
+
+    std::string activity;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_stallReported)
+        {
+            return;
+        }
+        m_stallReported = false;
+        activity.swap(m_stallActivity);
+    }
+
+    Stall stall{ QDateTime::currentDateTime(), beat - lastBeat - kBeatIntervalMs, QString::fromStdString(activity) };
+    LOG_WARNING() << "UI thread stalled for " << stall.durationMs << " ms in " << activity;
+
+    m_stalls.push_back(stall);
+    if (m_stalls.size() > kMaxStalls)
+    {
+        m_stalls.pop_front();
+    }
+    emit stallDetected();
+}
+
+void UiWatchdog::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopCondition.wait_for(lock, std::chrono::milliseconds(kBeatIntervalMs), [this] () { return m_stop; }))
+    {
+        if (m_stallReported)
+        {
+            continue;
+        }
+
+        const auto stalledFor = now() - m_lastBeat - kBeatIntervalMs;
+        if (stalledFor >= m_thresholdMs)
+        {
+            // taken while the UI thread is still busy, the full duration is known on the next beat
+            m_stallReported = true;
+            m_stallActivity = describeActivity();
+            LOG_WARNING() << "UI thread is not responding for " << stalledFor << " ms, busy in " << m_stallActivity;
+        }
+    }
+}
+
+qint64 UiWatchdog::now()
+{
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+std::string UiWatchdog::describeActivity()
+{
+    if (const char* activity = s_activity)
+    {
+        return activity;
+    }
+
+    const char* receiver = s_eventReceiver;
+    if (!receiver)
+    {
+        return "unknown";
+    }
+
+    if (const char* slot = s_eventSlot)
+    {
+        return std::string(receiver) + "::" + slot;
+    }
+    return std::string(receiver) + " event " + std::to_string(s_eventType.load());
+}
@@ -0,0 +1,110 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QDateTime>
+#include <QObject>
+#include <QTimer>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+//
+// Detects stalls of the UI event loop. UI thread beats with a timer, a separate thread
+// checks the beats and, if they stop for longer than the threshold, takes what the UI thread
+// is doing: the innermost Activity marker or the innermost Delivery of an event.
+// Stalls are logged and kept for the debug view.
+//
+class UiWatchdog : public QObject
+{
+    Q_OBJECT
+public:
+    struct Stall
+    {
+        QDateTime time;
+        qint64 durationMs;
+        QString activity;
+    };
+
+    //
+    // Names the work done on the UI thread while the marker is alive, nested markers restore the outer one.
+    // @name must be a string literal.
+    //
+    class Activity
+    {
+    public:
+        explicit Activity(const char* name);
+        ~Activity();
+
+    private:
+        const char* m_prev;
+    };
+
+    //
+    // Marks delivery of the event to the UI thread object, nested deliveries restore the outer one.
+    // Created by the application on every notify(), does nothing while there is no watchdog.
+    //
+    class Delivery
+    {
+    public:
+        Delivery(const QObject* receiver, const QEvent* event);
+        ~Delivery();
+
+    private:
+        bool m_marked = false;
+        const char* m_prevReceiver = nullptr;
+        const char* m_prevSlot = nullptr;
+        int m_prevType = 0;
+    };
+
+    explicit UiWatchdog(int thresholdMs);
+    ~UiWatchdog() override;
+
+    int getThresholdMs() const;
+    // Recent stalls, oldest first
+    const std::deque<Stall>& getStalls() const;
+
+signals:
+    void stallDetected();
+
+private:
+    void onBeat();
+    void run();
+    static qint64 now();
+    static std::string describeActivity();
+
+    const int m_thresholdMs;
+    QTimer m_beatTimer;
+    std::deque<Stall> m_stalls;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_stopCondition;
+    bool m_stop = false;
+
+    std::atomic<qint64> m_lastBeat;
+    // set by the watchdog thread for the stall in progress, guarded by m_mutex
+    bool m_stallReported = false;
+    std::string m_stallActivity;
+
+    static std::atomic<const char*> s_activity;
+    static std::atomic<const char*> s_eventReceiver;
+    static std::atomic<const char*> s_eventSlot;
+    static std::atomic<int> s_eventType;
+    // deliveries of the own beats are not marked, null while there is no watchdog
+    static std::atomic<const QObject*> s_beatTimer;
+};
@@ -30,11 +30,33 @@ namespace
 {
     const size_t kShieldedPer24hFilterSize = 20;
     const size_t kShieldedPer24hFilterBlocksForUpdate = 144;
+    // each filter sample is the difference between counts a filter size apart
+    const size_t kShieldedCountsWindowSize = kShieldedPer24hFilterSize * 2;
+    // about one frame
+    const int kChangesCoalescingWindowMs = 16;
+    const int kDeliveryStatsLogIntervalMs = 5 * 60 * 1000;
+
+    bool isSameTotals(const WalletStatus::AssetStatus& a, const WalletStatus::AssetStatus& b)
+    {
+        return a.available == b.available && a.maturing == b.maturing && a.maturingMP == b.maturingMP &&
+               a.receiving == b.receiving && a.receivingChange == b.receivingChange && a.receivingIncoming == b.receivingIncoming &&
+               a.sending == b.sending && a.shielded == b.shielded;
+    }
 }  // namespace
 
 WalletModel::WalletModel(IWalletDB::Ptr walletDB, const std::string& nodeAddr, beam::io::Reactor::Ptr reactor)
     : WalletClient(walletDB, nodeAddr, reactor),
-      m_shieldedPer24hFilter(std::make_unique<beamui::Filter>(kShieldedPer24hFilterSize))
+      m_shieldedPer24hFilter(std::make_unique<beamui::Filter>(kShieldedPer24hFilterSize)),
+      m_txChanges([](const TxDescription& tx) { return tx.m_txId; }),
+      m_txRowChanges([](const TxRow::Ptr& row) { return row->txId; }),
+      m_utxoChanges([](const Coin& coin) { return coin.m_ID; }),
+#ifdef BEAM_LELANTUS_SUPPORT
+      m_shieldedCoinChanges([](const ShieldedCoin& coin) { return coin.m_TxoID; }),
+#endif // BEAM_LELANTUS_SUPPORT
+      m_addressChanges([](const WalletAddress& address) { return address.m_walletID; }),
+      m_swapOfferChanges([](const SwapOffer& offer) { return offer.m_txId; }),
+      m_dexOrderChanges([](const DexOrder& order) { return order.orderID; }),
+      m_notificationChanges([](const Notification& notification) { return notification.m_ID; })
 {
     qRegisterMetaType<beam::ByteBuffer>("beam::ByteBuffer");
     qRegisterMetaType<beam::wallet::WalletStatus>("beam::wallet::WalletStatus");
@@ -58,11 +80,80 @@ WalletModel::WalletModel(IWalletDB::Ptr walletDB, const std::string& nodeAddr, b
     qRegisterMetaType<boost::optional<beam::wallet::WalletAddress>>("boost::optional<beam::wallet::WalletAddress>");
     qRegisterMetaType<beam::wallet::ShieldedCoinsSelectionInfo>("beam::wallet::ShieldedCoinsSelectionInfo");
     qRegisterMetaType<vector<beam::wallet::DexOrder>>("std::vector<beam::wallet::DexOrder>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::TxDescription>>("beamui::SharedItems<beam::wallet::TxDescription>");
+    qRegisterMetaType<beamui::SharedItems<TxRow::Ptr>>("beamui::SharedItems<TxRow::Ptr>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::Coin>>("beamui::SharedItems<beam::wallet::Coin>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::ShieldedCoin>>("beamui::SharedItems<beam::wallet::ShieldedCoin>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::WalletAddress>>("beamui::SharedItems<beam::wallet::WalletAddress>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::SwapOffer>>("beamui::SharedItems<beam::wallet::SwapOffer>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::DexOrder>>("beamui::SharedItems<beam::wallet::DexOrder>");
+    qRegisterMetaType<beamui::SharedItems<beam::wallet::Notification>>("beamui::SharedItems<beam::wallet::Notification>");
 
     connect(this, &WalletModel::walletStatusInternal, this, &WalletModel::onWalletStatusInternal);
     connect(this, SIGNAL(addressesChanged(bool, const std::vector<beam::wallet::WalletAddress>&)),this, SLOT(setAddresses(bool, const std::vector<beam::wallet::WalletAddress>&)));
     connect(this, SIGNAL(functionPosted(const std::function<void()>&)), this, SLOT(doFunction(const std::function<void()>&)));
 
+    // Internal signals are emitted from the reactor thread, so these are queued to the UI thread.
+    // Only shared pointer is copied into the queued event, public signals are emitted
+    // on the UI thread and all subscribers get the same vector by reference
+    connect(this, &WalletModel::transactionsChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<TxDescription>& items, const beamui::SharedItems<TxRow::Ptr>& rows, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("transactions", sentAt);
+        onChangesInternal(m_txRowChanges, &WalletModel::transactionRowsChanged, action, *rows, "transactionRows");
+        onChangesInternal(m_txChanges, &WalletModel::transactionsChanged, action, *items, "transactions");
+    });
+    connect(this, &WalletModel::allUtxoChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<Coin>& items, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("utxo", sentAt);
+        onChangesInternal(m_utxoChanges, &WalletModel::allUtxoChanged, action, *items, "utxo");
+    });
+#ifdef BEAM_LELANTUS_SUPPORT
+    connect(this, &WalletModel::shieldedCoinChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<ShieldedCoin>& items, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("shieldedCoins", sentAt);
+        onChangesInternal(m_shieldedCoinChanges, &WalletModel::shieldedCoinChanged, action, *items, "shieldedCoins");
+    });
+#endif // BEAM_LELANTUS_SUPPORT
+    connect(this, &WalletModel::addressesChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<WalletAddress>& items, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("addresses", sentAt);
+        updateOwnAddresses(action, *items);
+        using Notify = void (WalletModel::*)(ChangeAction, const std::vector<WalletAddress>&);
+        onChangesInternal(m_addressChanges, static_cast<Notify>(&WalletModel::addressesChanged), action, *items, "addresses");
+    });
+    connect(this, &WalletModel::swapOffersChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<SwapOffer>& items, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("swapOffers", sentAt);
+        onChangesInternal(m_swapOfferChanges, &WalletModel::swapOffersChanged, action, *items, "swapOffers");
+    });
+    connect(this, &WalletModel::dexOrdersChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<DexOrder>& items, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("dexOrders", sentAt);
+        onChangesInternal(m_dexOrderChanges, &WalletModel::dexOrdersChanged, action, *items, "dexOrders");
+    });
+    connect(this, &WalletModel::notificationsChangedInternal, this, [this] (ChangeAction action, const beamui::SharedItems<Notification>& items, qint64 sentAt)
+    {
+        m_deliveryStats.addQueueLatency("notifications", sentAt);
+        onChangesInternal(m_notificationChanges, &WalletModel::notificationsChanged, action, *items, "notifications");
+    });
+
+    m_flushChangesTimer.setSingleShot(true);
+    m_flushChangesTimer.setInterval(kChangesCoalescingWindowMs);
+    connect(&m_flushChangesTimer, &QTimer::timeout, this, &WalletModel::flushChanges);
+
+    m_deliveryStatsLogTimer.setInterval(kDeliveryStatsLogIntervalMs);
+    connect(&m_deliveryStatsLogTimer, &QTimer::timeout, this, [this] ()
+    {
+        if (!m_deliveryStats.empty())
+        {
+            LOG_INFO() << "UI delivery stats: " << m_deliveryStats.toString();
+        }
+    });
+    m_deliveryStatsLogTimer.start();
+
+    m_txStore = std::make_unique<TxStore>(*this);
+    m_shieldedCounts = AppModel::getInstance().getSettings().getShieldedCountSamples();
+
     getAsync()->getAddresses(true);
 }
 
@@ -128,12 +219,21 @@ bool WalletModel::isAddressWithCommentExist(const std::string& comment) const
 
 void WalletModel::onStatus(const beam::wallet::WalletStatus& status)
 {
-    emit walletStatusInternal(status);
+    emit walletStatusInternal(status, beamui::DeliveryStats::now());
 }
 
 void WalletModel::onTxStatus(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
 {
-    emit transactionsChanged(action, items);
+    const auto sentAt = beamui::DeliveryStats::now();
+
+    // decode transactions here, UI thread gets ready rows
+    auto rows = std::make_shared<std::vector<TxRow::Ptr>>();
+    rows->reserve(items.size());
+    for (const auto& item : items)
+    {
+        rows->push_back(TxRow::fromDescription(item));
+    }
+    emit transactionsChangedInternal(action, std::make_shared<const std::vector<TxDescription>>(items), std::move(rows), sentAt);
 }
 
 void WalletModel::onSyncProgressUpdated(int done, int total)
@@ -153,19 +253,23 @@ void WalletModel::onShieldedCoinsSelectionCalculated(const ShieldedCoinsSelectio
 
 void WalletModel::onAllUtxoChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::Coin>& utxos)
 {
-    emit allUtxoChanged(action, utxos);
+    emit allUtxoChangedInternal(action, std::make_shared<const std::vector<Coin>>(utxos), beamui::DeliveryStats::now());
 }
 
 void WalletModel::onShieldedCoinChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::ShieldedCoin>& items)
 {
 #ifdef BEAM_LELANTUS_SUPPORT
-    emit shieldedCoinChanged(action, items);
+    emit shieldedCoinChangedInternal(action, std::make_shared<const std::vector<ShieldedCoin>>(items), beamui::DeliveryStats::now());
 #endif
 }
 
 void WalletModel::onAddressesChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::WalletAddress>& items)
 {
-    emit addressesChanged(action, items);
+    emit addressesChangedInternal(action, std::make_shared<const std::vector<WalletAddress>>(items), beamui::DeliveryStats::now());
+}
+
+void WalletModel::updateOwnAddresses(beam::wallet::ChangeAction action, const std::vector<beam::wallet::WalletAddress>& items)
+{
     for (const auto& item : items)
     {
         if (item.isOwn())
@@ -192,13 +296,13 @@ void WalletModel::onAddresses(bool own, const std::vector<beam::wallet::WalletAd
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
 void WalletModel::onSwapOffersChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::SwapOffer>& offers)
 {
-    emit swapOffersChanged(action, offers);
+    emit swapOffersChangedInternal(action, std::make_shared<const std::vector<SwapOffer>>(offers), beamui::DeliveryStats::now());
 }
 #endif  // BEAM_ATOMIC_SWAP_SUPPORT
 
 void WalletModel::onDexOrdersChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::DexOrder>& offers)
 {
-    emit dexOrdersChanged(action, offers);
+    emit dexOrdersChangedInternal(action, std::make_shared<const std::vector<DexOrder>>(offers), beamui::DeliveryStats::now());
 }
 
 void WalletModel::onCoinsByTx(const std::vector<beam::wallet::Coin>& coins)
@@ -319,7 +423,7 @@ void WalletModel::onExchangeRates(const std::vector<beam::wallet::ExchangeRate>&
 
 void WalletModel::onNotificationsChanged(beam::wallet::ChangeAction action, const std::vector<Notification>& notifications)
 {
-    emit notificationsChanged(action, notifications);
+    emit notificationsChangedInternal(action, std::make_shared<const std::vector<Notification>>(notifications), beamui::DeliveryStats::now());
 }
 
 void WalletModel::onPublicAddress(const std::string& publicAddr)
@@ -440,62 +544,312 @@ uint8_t WalletModel::getMPLockTimeLimit() const
     return m_mpLockTimeLimit;
 }
 
+void WalletModel::refreshMPLockTimeLimit()
+{
+    m_mpLockTimeLimitRequested = true;
+    getAsync()->getMaxPrivacyLockTimeLimitHours([this] (uint8_t limit)
+    {
+        m_mpLockTimeLimit = limit;
+    });
+}
+
+void WalletModel::requestShieldedCounts(const std::vector<beam::Height>& heights, std::function<void(ShieldedCounts&&)> done)
+{
+    std::set<Height> unique(heights.begin(), heights.end());
+    if (unique.empty())
+    {
+        done({});
+        return;
+    }
+
+    // the client API answers one height per request, replies are collected here
+    // and handed over at once, in whatever order they come
+    struct Request
+    {
+        ShieldedCounts counts;
+        size_t left;
+        std::function<void(ShieldedCounts&&)> done;
+    };
+    auto request = std::make_shared<Request>(Request{ {}, unique.size(), std::move(done) });
+
+    for (auto h : unique)
+    {
+        getAsync()->getShieldedCountAt(h, [request] (Height h, TxoID count)
+        {
+            request->counts[h] = count;
+            if (--request->left == 0)
+            {
+                request->done(std::move(request->counts));
+            }
+        });
+    }
+}
+
+TxStore& WalletModel::getTxStore()
+{
+    return *m_txStore;
+}
+
+void WalletModel::setChangesCoalescing(bool enabled)
+{
+    m_coalesceChanges = enabled;
+}
+
+const beamui::DeliveryStats& WalletModel::getDeliveryStats() const
+{
+    return m_deliveryStats;
+}
+
+void WalletModel::resetDeliveryStats()
+{
+    m_deliveryStats.clear();
+}
+
+template <typename Func>
+void WalletModel::measureHandler(const char* statsName, Func&& func)
+{
+    const auto startedAt = beamui::DeliveryStats::now();
+    func();
+    m_deliveryStats.addHandlerTime(statsName, startedAt);
+}
+
+template <typename T, typename Key>
+void WalletModel::onChangesInternal(beamui::ChangeBatch<T, Key>& batch,
+                                    void (WalletModel::*notify)(beam::wallet::ChangeAction, const std::vector<T>&),
+                                    beam::wallet::ChangeAction action,
+                                    const std::vector<T>& items,
+                                    const char* statsName)
+{
+    if (!m_coalesceChanges)
+    {
+        measureHandler(statsName, [&] ()
+        {
+            (this->*notify)(action, items);
+        });
+        return;
+    }
+
+    batch.add(action, items);
+    if (!m_flushChangesTimer.isActive())
+    {
+        m_flushChangesTimer.start();
+    }
+}
+
+void WalletModel::flushChanges()
+{
+    // emitted on the UI thread, subscribers are called directly
+    m_addressChanges.flush([this] (ChangeAction action, const std::vector<WalletAddress>& items)
+    {
+        measureHandler("addresses", [&] ()
+        {
+            emit addressesChanged(action, items);
+        });
+    });
+    m_utxoChanges.flush([this] (ChangeAction action, const std::vector<Coin>& items)
+    {
+        measureHandler("utxo", [&] ()
+        {
+            emit allUtxoChanged(action, items);
+        });
+    });
+#ifdef BEAM_LELANTUS_SUPPORT
+    m_shieldedCoinChanges.flush([this] (ChangeAction action, const std::vector<ShieldedCoin>& items)
+    {
+        measureHandler("shieldedCoins", [&] ()
+        {
+            emit shieldedCoinChanged(action, items);
+        });
+    });
+#endif // BEAM_LELANTUS_SUPPORT
+    m_txRowChanges.flush([this] (ChangeAction action, const std::vector<TxRow::Ptr>& rows)
+    {
+        measureHandler("transactionRows", [&] ()
+        {
+            emit transactionRowsChanged(action, rows);
+        });
+    });
+    m_txChanges.flush([this] (ChangeAction action, const std::vector<TxDescription>& items)
+    {
+        measureHandler("transactions", [&] ()
+        {
+            emit transactionsChanged(action, items);
+        });
+    });
+    m_swapOfferChanges.flush([this] (ChangeAction action, const std::vector<SwapOffer>& items)
+    {
+        measureHandler("swapOffers", [&] ()
+        {
+            emit swapOffersChanged(action, items);
+        });
+    });
+    m_dexOrderChanges.flush([this] (ChangeAction action, const std::vector<DexOrder>& items)
+    {
+        measureHandler("dexOrders", [&] ()
+        {
+            emit dexOrdersChanged(action, items);
+        });
+    });
+    m_notificationChanges.flush([this] (ChangeAction action, const std::vector<Notification>& items)
+    {
+        measureHandler("notifications", [&] ()
+        {
+            emit notificationsChanged(action, items);
+        });
+    });
+}
+
 bool WalletModel::hasShielded(beam::Asset::ID id) const
 {
     const auto& status = m_status.GetStatus(id);
     return status.shielded != Zero;
 }
 
-void WalletModel::onWalletStatusInternal(const beam::wallet::WalletStatus& newStatus)
+void WalletModel::onWalletStatusInternal(const beam::wallet::WalletStatus& newStatus, qint64 sentAt)
 {
+    m_deliveryStats.addQueueLatency("status", sentAt);
+
+    const auto prevStatus = std::move(m_status);
     m_status = newStatus;
-    emit walletStatusChanged();
+    measureHandler("status", [this, &prevStatus] ()
+    {
+        notifyStatusChanges(prevStatus);
+        emit walletStatusChanged();
+    });
 
-    if (m_status.stateID != newStatus.stateID)
+    if (prevStatus.stateID != m_status.stateID)
     {
-        if (!m_status.stateID.m_Height || !(newStatus.stateID.m_Height % kShieldedPer24hFilterBlocksForUpdate))
-        {
-            m_shieldedCountHistoryPart.clear();
-            auto shieldedCountHistoryWindowSize = kShieldedPer24hFilterSize << 1;
+        updateShieldedPer24h();
+    }
+
+    if (!m_mpLockTimeLimitRequested)
+    {
+        refreshMPLockTimeLimit();
+    }
+}
 
-            if (newStatus.stateID.m_Height > kShieldedPer24hFilterBlocksForUpdate * shieldedCountHistoryWindowSize)
+void WalletModel::notifyStatusChanges(const beam::wallet::WalletStatus& prevStatus)
+{
+    // both maps are ordered by asset id, walk them together
+    auto prev = prevStatus.all.begin();
+    auto curr = m_status.all.begin();
+    const WalletStatus::AssetStatus empty;
+    while (prev != prevStatus.all.end() || curr != m_status.all.end())
+    {
+        if (curr == m_status.all.end() || (prev != prevStatus.all.end() && prev->first < curr->first))
+        {
+            if (!isSameTotals(prev->second, empty))
+            {
+                emit assetTotalsChanged(prev->first);
+            }
+            ++prev;
+        }
+        else if (prev == prevStatus.all.end() || curr->first < prev->first)
+        {
+            if (!isSameTotals(curr->second, empty))
             {
-                m_shieldedCountHistoryPart.reserve(shieldedCountHistoryWindowSize);
-
-                for (uint8_t i = 0; i < shieldedCountHistoryWindowSize; ++i)
-                {
-                    auto h = newStatus.stateID.m_Height - (kShieldedPer24hFilterBlocksForUpdate * i);
-                    getAsync()->getShieldedCountAt(h, [this, shieldedCountHistoryWindowSize] (Height h, TxoID count)
-                    {
-                        m_shieldedCountHistoryPart.emplace_back(h, count);
-                        if (m_shieldedCountHistoryPart.size() == shieldedCountHistoryWindowSize)
-                        {
-                            for (uint8_t i = 0; i < kShieldedPer24hFilterSize; ++i)
-                            {
-                                if (m_shieldedCountHistoryPart[i].second)
-                                {
-                                    double b = m_shieldedCountHistoryPart[i].second - m_shieldedCountHistoryPart[i + kShieldedPer24hFilterSize].second;
-                                    m_shieldedPer24hFilter->addSample(b);
-                                }
-                                else
-                                {
-                                    m_shieldedPer24hFilter->addSample(0);
-                                }
-                                
-                            }
-                            m_shieldedPer24h = static_cast<TxoID>(floor(m_shieldedPer24hFilter->getAverage() * 10));
-                        }
-                    });
-                }
+                emit assetTotalsChanged(curr->first);
             }
+            ++curr;
+        }
+        else
+        {
+            if (!isSameTotals(prev->second, curr->second))
+            {
+                emit assetTotalsChanged(curr->first);
+            }
+            ++prev;
+            ++curr;
         }
     }
-    getAsync()->getMaxPrivacyLockTimeLimitHours([this] (uint8_t limit)
+
+    if (prevStatus.stateID != m_status.stateID)
     {
-        m_mpLockTimeLimit = limit;
+        emit stateIDChanged();
+    }
+
+    if (prevStatus.shieldedTotalCount != m_status.shieldedTotalCount)
+    {
+        emit shieldedTotalCountChanged();
+    }
+}
+
+void WalletModel::updateShieldedPer24h()
+{
+    const Height height = m_status.stateID.m_Height;
+    if (height <= kShieldedPer24hFilterBlocksForUpdate * kShieldedCountsWindowSize)
+    {
+        return;
+    }
+
+    // samples are taken at the boundaries, so the window moves once per 144 blocks
+    const Height base = height - height % kShieldedPer24hFilterBlocksForUpdate;
+    if (base == m_shieldedCountsBase)
+    {
+        return;
+    }
+    m_shieldedCountsBase = base;
+
+    ShieldedCounts window;
+    std::vector<Height> missing;
+    for (size_t i = 0; i < kShieldedCountsWindowSize; ++i)
+    {
+        const Height h = base - kShieldedPer24hFilterBlocksForUpdate * i;
+        auto it = m_shieldedCounts.find(h);
+        if (it != m_shieldedCounts.end())
+        {
+            window.insert(*it);
+        }
+        else
+        {
+            missing.push_back(h);
+        }
+    }
+    m_shieldedCounts.swap(window);
+
+    if (missing.empty())
+    {
+        calcShieldedPer24h();
+        return;
+    }
+
+    requestShieldedCounts(missing, [this, base] (ShieldedCounts&& counts)
+    {
+        if (base != m_shieldedCountsBase)
+        {
+            // window has moved while the counts were requested, the newer request fills it
+            return;
+        }
+        m_shieldedCounts.insert(counts.begin(), counts.end());
+        AppModel::getInstance().getSettings().setShieldedCountSamples(m_shieldedCounts);
+        calcShieldedPer24h();
     });
 }
 
+void WalletModel::calcShieldedPer24h()
+{
+    if (m_shieldedCounts.size() != kShieldedCountsWindowSize)
+    {
+        return;
+    }
+
+    // ascending heights, the latest filter size samples are the recent ends of the differences
+    std::vector<TxoID> counts;
+    counts.reserve(m_shieldedCounts.size());
+    for (const auto& p : m_shieldedCounts)
+    {
+        counts.push_back(p.second);
+    }
+
+    for (size_t i = 0; i < kShieldedPer24hFilterSize; ++i)
+    {
+        const auto later = counts[i + kShieldedPer24hFilterSize];
+        const auto earlier = counts[i];
+        m_shieldedPer24hFilter->addSample(later > earlier ? static_cast<double>(later - earlier) : 0);
+    }
+    m_shieldedPer24h = static_cast<TxoID>(floor(m_shieldedPer24hFilter->getAverage() * 10));
+}
+
 void WalletModel::setAddresses(bool own, const std::vector<beam::wallet::WalletAddress>& addrs)
 {
     if (own)
@@ -15,18 +15,29 @@
 #pragma once
 
 #include <QObject>
+#include <QTimer>
 
 #include "wallet/client/wallet_client.h"
+#include "change_batch.h"
+#include "delivery_stats.h"
+#include "tx_row.h"
+#include "tx_store.h"
 
 #ifdef BEAM_HW_WALLET
 #include "keykeeper/hw_wallet.h"
 #endif
 
+#include <map>
 #include <set>
 
 namespace beamui
 {
     class Filter;
+
+    // Immutable change batch, built once on the reactor thread
+    // and shared read-only with the UI thread
+    template <typename T>
+    using SharedItems = std::shared_ptr<const std::vector<T>>;
 }  // namespace beamui
 
 class WalletModel
@@ -62,6 +73,22 @@ public:
     beam::TxoID getTotalShieldedCount() const;
     beam::TxoID getShieldedPer24h() const;
     uint8_t getMPLockTimeLimit() const;
+    // Drops the cached max privacy lock time limit and requests it again, call after the limit is changed
+    void refreshMPLockTimeLimit();
+
+    using ShieldedCounts = std::map<beam::Height, beam::TxoID>;
+    // Shielded outputs count at each of @heights, @done is called once with all of them
+    void requestShieldedCounts(const std::vector<beam::Height>& heights, std::function<void(ShieldedCounts&&)> done);
+
+    // Shared transactions history, views should subscribe to it instead of requesting transactions
+    TxStore& getTxStore();
+    // Delivery times of the wallet callbacks to the UI subscribers
+    const beamui::DeliveryStats& getDeliveryStats() const;
+    void resetDeliveryStats();
+
+    // Change notifications are merged on the UI thread and delivered
+    // once per coalescing window. Should be set before the wallet is started
+    void setChangesCoalescing(bool enabled);
 
 signals:
     // INTERNAL SIGNALS, DO NOT SUBSCRIBE IN OTHER UI OBJECTS.
@@ -69,15 +96,32 @@ signals:
     // These are used to redirect from reactor thread to the UI thread
     // and cache some data. Due to old designed getters (getAvailable &c.).
     // Better to avoid such internal signals
-    void walletStatusInternal(const beam::wallet::WalletStatus& status);
+    void walletStatusInternal(const beam::wallet::WalletStatus& status, qint64 sentAt);
+    void transactionsChangedInternal(beam::wallet::ChangeAction, beamui::SharedItems<beam::wallet::TxDescription> items, beamui::SharedItems<TxRow::Ptr> rows, qint64 sentAt);
+    void allUtxoChangedInternal(beam::wallet::ChangeAction, beamui::SharedItems<beam::wallet::Coin> utxos, qint64 sentAt);
+#ifdef BEAM_LELANTUS_SUPPORT
+    void shieldedCoinChangedInternal(beam::wallet::ChangeAction, beamui::SharedItems<beam::wallet::ShieldedCoin> coins, qint64 sentAt);
+#endif // BEAM_LELANTUS_SUPPORT
+    void addressesChangedInternal(beam::wallet::ChangeAction, beamui::SharedItems<beam::wallet::WalletAddress> addresses, qint64 sentAt);
+    void swapOffersChangedInternal(beam::wallet::ChangeAction action, beamui::SharedItems<beam::wallet::SwapOffer> offers, qint64 sentAt);
+    void dexOrdersChangedInternal(beam::wallet::ChangeAction action, beamui::SharedItems<beam::wallet::DexOrder> offers, qint64 sentAt);
+    void notificationsChangedInternal(beam::wallet::ChangeAction, beamui::SharedItems<beam::wallet::Notification> notifications, qint64 sentAt);
 
     // Public Signal
+    // Emitted for every status update, after the per asset and state signals of the same update
     void walletStatusChanged();
+    // Totals of the asset differ from the previous status
+    void assetTotalsChanged(beam::Asset::ID assetId);
+    // Height or tip hash differs from the previous status
+    void stateIDChanged();
     void assetInfoChanged(beam::Asset::ID assetId, const beam::wallet::WalletAsset& info);
     void iwtCallResult(const QString& callId, boost::any);
 
 signals:
+    // Raw wallet notifications, UI objects should use TxStore
     void transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>& items);
+    // Same changes projected on the reactor thread, emitted before transactionsChanged in the same order
+    void transactionRowsChanged(beam::wallet::ChangeAction, const std::vector<TxRow::Ptr>& rows);
     void syncProgressUpdated(int done, int total);
     void changeCalculated(beam::Amount changeAsset, beam::Amount changeBeam, beam::Asset::ID);
     void shieldedCoinsSelectionCalculated(const beam::wallet::ShieldedCoinsSelectionInfo& selectionRes);
@@ -156,16 +200,51 @@ private:
     uint32_t getClientRevision() const override;
 
 private slots:
-    void onWalletStatusInternal(const beam::wallet::WalletStatus& status);
+    void onWalletStatusInternal(const beam::wallet::WalletStatus& status, qint64 sentAt);
     void setAddresses(bool own, const std::vector<beam::wallet::WalletAddress>& addrs);
     void doFunction(const std::function<void()>& func);
+    void flushChanges();
 
 private:
+    template <typename T, typename Key>
+    void onChangesInternal(beamui::ChangeBatch<T, Key>& batch,
+                           void (WalletModel::*notify)(beam::wallet::ChangeAction, const std::vector<T>&),
+                           beam::wallet::ChangeAction action,
+                           const std::vector<T>& items,
+                           const char* statsName);
+    template <typename Func>
+    void measureHandler(const char* statsName, Func&& func);
+    void updateOwnAddresses(beam::wallet::ChangeAction action, const std::vector<beam::wallet::WalletAddress>& items);
+    void notifyStatusChanges(const beam::wallet::WalletStatus& prevStatus);
+    void updateShieldedPer24h();
+    void calcShieldedPer24h();
+
     std::unique_ptr<beamui::Filter> m_shieldedPer24hFilter;
     std::set<beam::wallet::WalletID> m_myWalletIds;
     std::set<std::string> m_myAddrLabels;
     beam::wallet::WalletStatus m_status;
-    std::vector<std::pair<beam::wallet::Height, beam::wallet::TxoID>> m_shieldedCountHistoryPart;
+    // shielded counts at the 144 blocks boundaries of the estimate window, persisted in settings
+    ShieldedCounts m_shieldedCounts;
+    beam::Height m_shieldedCountsBase = 0;
     beam::wallet::TxoID m_shieldedPer24h = 0;
     uint8_t m_mpLockTimeLimit = 0;
+    bool m_mpLockTimeLimitRequested = false;
+
+    std::unique_ptr<TxStore> m_txStore;
+
+    beamui::DeliveryStats m_deliveryStats;
+    QTimer m_deliveryStatsLogTimer;
+
+    bool m_coalesceChanges = false;
+    QTimer m_flushChangesTimer;
+    beamui::ChangeBatch<beam::wallet::TxDescription, beam::wallet::TxID> m_txChanges;
+    beamui::ChangeBatch<TxRow::Ptr, beam::wallet::TxID> m_txRowChanges;
+    beamui::ChangeBatch<beam::wallet::Coin, beam::wallet::Coin::ID> m_utxoChanges;
+#ifdef BEAM_LELANTUS_SUPPORT
+    beamui::ChangeBatch<beam::wallet::ShieldedCoin, beam::TxoID> m_shieldedCoinChanges;
+#endif // BEAM_LELANTUS_SUPPORT
+    beamui::ChangeBatch<beam::wallet::WalletAddress, beam::wallet::WalletID> m_addressChanges;
+    beamui::ChangeBatch<beam::wallet::SwapOffer, beam::wallet::TxID> m_swapOfferChanges;
+    beamui::ChangeBatch<beam::wallet::DexOrder, beam::wallet::DexOrderID> m_dexOrderChanges;
+    beamui::ChangeBatch<beam::wallet::Notification, ECC::uintBig> m_notificationChanges;
 };
@@ -37,6 +37,7 @@
 #include "viewmodel/wallet/tx_table.h"
 #include "viewmodel/wallet/info_view.h"
 #include "viewmodel/help_view.h"
+#include "viewmodel/delivery_stats_view.h"
 #include "viewmodel/settings_view.h"
 #include "viewmodel/messages_view.h"
 #include "viewmodel/statusbar_view.h"
@@ -53,7 +54,6 @@
 #include "viewmodel/helpers/token_bootstrap_manager.h"
 #include "viewmodel/notifications/notifications_view.h"
 #include "viewmodel/notifications/push_notification_manager.h"
-#include "viewmodel/notifications/exchange_rates_manager.h"
 #include "wallet/core/wallet_db.h"
 #include "utility/log_rotation.h"
 #include "core/ecc_native.h"
@@ -93,6 +93,22 @@ using namespace beam;
 using namespace std;
 using namespace ECC;
 
+namespace
+{
+    // Marks event deliveries for UiWatchdog
+    class Application : public QApplication
+    {
+    public:
+        using QApplication::QApplication;
+
+        bool notify(QObject* receiver, QEvent* event) override
+        {
+            UiWatchdog::Delivery delivery(receiver, event);
+            return QApplication::notify(receiver, event);
+        }
+    };
+}  // namespace
+
 #ifdef APP_NAME
 static const char* AppName = APP_NAME;
 #else
@@ -107,7 +123,7 @@ int main (int argc, char* argv[])
     QApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
 
     block_sigpipe();
-    QApplication app(argc, argv);
+    Application app(argc, argv);
     QDir appDataDir(QStandardPaths::writableLocation(QStandardPaths::DataLocation));
 
     QApplication::setWindowIcon(QIcon(Theme::iconPath()));
@@ -236,6 +252,7 @@ int main (int argc, char* argv[])
             qmlRegisterType<SwapOffersViewModel>("Beam.Wallet", 1, 0, "SwapOffersViewModel");
             qmlRegisterType<NotificationsViewModel>("Beam.Wallet", 1, 0, "NotificationsViewModel");
             qmlRegisterType<HelpViewModel>("Beam.Wallet", 1, 0, "HelpViewModel");
+            qmlRegisterType<DeliveryStatsViewModel>("Beam.Wallet", 1, 0, "DeliveryStatsViewModel");
             qmlRegisterType<MessagesViewModel>("Beam.Wallet", 1, 0, "MessagesViewModel");
             qmlRegisterType<StatusbarViewModel>("Beam.Wallet", 1, 0, "StatusbarViewModel");
             qmlRegisterType<ReceiveViewModel>("Beam.Wallet", 1, 0, "ReceiveViewModel");
@@ -258,7 +275,6 @@ int main (int argc, char* argv[])
             qmlRegisterType<SwapCoinClientWrapper>("Beam.Wallet", 1, 0, "SwapCoinClientWrapper");
             qmlRegisterType<TokenBootstrapManager>("Beam.Wallet", 1, 0, "TokenBootstrapManager");
             qmlRegisterType<PushNotificationManager>("Beam.Wallet", 1, 0, "PushNotificationManager");
-            qmlRegisterType<ExchangeRatesManager>("Beam.Wallet", 1, 0, "ExchangeRatesManager");
             qmlRegisterType<SortFilterProxyModel>("Beam.Wallet", 1, 0, "SortFilterProxyModel");
             qmlRegisterType<QR>("Beam.Wallet", 1, 0, "QR");
             qmlRegisterType<beamui::dex::DexView>("Beam.Wallet", 1, 0, "DexViewModel");
@@ -179,6 +179,7 @@ Item {
                 Layout.topMargin:  12
                 Layout.fillWidth:  true
                 Layout.fillHeight: true
+                selectedAsset:     assets.selectedId
             }
         }
     }
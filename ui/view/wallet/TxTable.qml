@@ -11,8 +11,20 @@ import "../utils.js" as Utils
 Control {
     id: control
 
+    property int selectedAsset: -1
+    property string statusFilterRole: ""
+    readonly property bool isDefaultOrder: transactionsTable.sortIndicatorColumn == 1 &&
+                                           transactionsTable.sortIndicatorOrder == Qt.DescendingOrder
+
     TxTableViewModel {
         id: tableViewModel
+        // older transactions are loaded when the table is scrolled down,
+        // other orders need the whole history
+        pageSize: control.isDefaultOrder ? 100 : 0
+        // not loaded transactions are fetched only if they pass the filters
+        assetFilter: control.selectedAsset
+        statusFilter: control.statusFilterRole
+        searchFilter: searchBox.text
     }
 
     state: "all"
@@ -20,26 +32,22 @@ Control {
         State {
             name: "all"
             PropertyChanges { target: allTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "status" }
-            PropertyChanges { target: txProxyModel; filterString: "*" }
+            PropertyChanges { target: control; statusFilterRole: "" }
         },
         State {
             name: "inProgress"
             PropertyChanges { target: inProgressTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isInProgress" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: control; statusFilterRole: "isInProgress" }
         },
         State {
             name: "sent"
             PropertyChanges { target: sentTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isSent" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: control; statusFilterRole: "isSent" }
         },
         State {
             name: "received"
             PropertyChanges { target: receivedTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isReceived" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: control; statusFilterRole: "isReceived" }
         }
     ]
 
@@ -149,18 +157,27 @@ Control {
             Component.onCompleted: {
                 transactionsTable.model.modelReset.connect(function(){
                     if (root.openedTxID != "") {
+                        tableViewModel.fetchTransaction(root.openedTxID);
                         var index = tableViewModel.transactions.index(0, 0);
                         var indexList = tableViewModel.transactions.match(index, TxObjectList.Roles.TxID, root.openedTxID)
                         if (indexList.length > 0) {
-                            index = assetFilterProxy.mapFromSource(indexList[0])
-                            index = searchProxyModel.mapFromSource(index)
-                            index = txProxyModel.mapFromSource(index)
+                            index = txProxyModel.mapFromSource(indexList[0])
                             transactionsTable.positionViewAtRow(index.row, ListView.Beginning)
                         }
                     }
                 })
             }
 
+            Connections {
+                target: transactionsTable.flickableItem
+                onAtYBeginningChanged: {
+                    // the newest transactions are on top, does nothing if paging is off
+                    if (transactionsTable.flickableItem.atYBeginning) {
+                        tableViewModel.releasePages();
+                    }
+                }
+            }
+
             Layout.alignment: Qt.AlignTop
             Layout.fillWidth : true
             Layout.fillHeight : true
@@ -183,29 +200,27 @@ Control {
 
             model: SortFilterProxyModel {
                 id: txProxyModel
-                source: SortFilterProxyModel {
-                    id: searchProxyModel
-                    source: tableViewModel.transactions
-                    filterRole: "search"
-                    filterString: searchBox.text
-                    filterSyntax: SortFilterProxyModel.Wildcard
-                    filterCaseSensitivity: Qt.CaseInsensitive
-
-                    source: SortFilterProxyModel {
-                        id: assetFilterProxy
-                        filterRole:   "assetFilter"
-                        filterString: control.selectedAsset < 0 ? "" : ["\\b", control.selectedAsset, "\\b"].join("")
-                        filterSyntax: SortFilterProxyModel.RegExp
-                        source: tableViewModel.transactions
+                source: tableViewModel.transactions
+
+                filterRole: "search"
+                filterString: searchBox.text
+                filterSyntax: SortFilterProxyModel.Wildcard
+                filterCaseSensitivity: Qt.CaseInsensitive
+
+                filters: {
+                    var filters = {};
+                    if (control.selectedAsset >= 0) {
+                        filters["assetFilter"] = control.selectedAsset;
+                    }
+                    if (control.statusFilterRole != "") {
+                        filters[control.statusFilterRole] = true;
                     }
+                    return filters;
                 }
 
                 sortOrder: transactionsTable.sortIndicatorOrder
                 sortCaseSensitivity: Qt.CaseInsensitive
                 sortRole: transactionsTable.getColumn(transactionsTable.sortIndicatorColumn).role + "Sort"
-
-                filterSyntax: SortFilterProxyModel.Wildcard
-                filterCaseSensitivity: Qt.CaseInsensitive
             }
 
             rowDelegate: ExpandableRowDelegate {
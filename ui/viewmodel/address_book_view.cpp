@@ -151,15 +151,12 @@ AddressBookViewModel::AddressBookViewModel()
     connect(&m_model,
             SIGNAL(addressesChanged(bool, const std::vector<beam::wallet::WalletAddress>&)),
             SLOT(onAddresses(bool, const std::vector<beam::wallet::WalletAddress>&)));
-    connect(&m_model,
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactions(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
     connect(&m_model,
             SIGNAL(addressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>&)),
             SLOT(onAddressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>&)));
 
     getAddressesFromModel();
-    m_model.getAsync()->getTransactions();
+    m_model.getTxStore().subscribe(this, &AddressBookViewModel::onTransactions);
     startTimer(3 * 1000);
 }
 
@@ -24,6 +24,17 @@ using namespace beam::wallet;
 using namespace std;
 namespace btc = beam::bitcoin;
 
+namespace
+{
+    struct SwapTxData
+    {
+        TxDescription tx;
+        TxRow::Ptr row;
+        uint32_t minTxConfirmations;
+        double blocksPerHour;
+    };
+}  // namespace
+
 SwapCoinClientWrapper::SwapCoinClientWrapper(wallet::AtomicSwapCoin swapCoin)
     : m_swapCoin(swapCoin),
       m_coinClient(AppModel::getInstance().getSwapCoinClient(swapCoin))
@@ -112,11 +123,13 @@ SwapOffersViewModel::SwapOffersViewModel()
 {
     InitSwapClientWrappers();
 
-    connect(&m_walletModel, &WalletModel::walletStatusChanged, this, &SwapOffersViewModel::beamAvailableChanged);
-    connect(&m_walletModel,
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactionsDataModelChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
-
+    connect(&m_walletModel, &WalletModel::assetTotalsChanged, this, [this] (beam::Asset::ID assetId)
+    {
+        if (assetId == beam::Asset::s_BeamID)
+        {
+            emit beamAvailableChanged();
+        }
+    });
     connect(&m_walletModel,
             SIGNAL(swapOffersChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::SwapOffer>&)),
             SLOT(onSwapOffersDataModelChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::SwapOffer>&)));
@@ -124,7 +137,7 @@ SwapOffersViewModel::SwapOffersViewModel()
     monitorAllOffersFitBalance();
 
     m_walletModel.getAsync()->getSwapOffers();
-    m_walletModel.getAsync()->getTransactions();    
+    m_walletModel.getTxStore().subscribe(this, &SwapOffersViewModel::onTransactionsDataModelChanged);
 }
 
 SwapOffersViewModel::~SwapOffersViewModel()
@@ -193,11 +206,13 @@ PaymentInfoItem* SwapOffersViewModel::getPaymentInfo(const QVariant& variantTxID
 
 void SwapOffersViewModel::onTransactionsDataModelChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
 {
-    vector<shared_ptr<SwapTxObject>> swapTransactions;
-    vector<shared_ptr<SwapTxObject>> activeTransactions;
-    vector<shared_ptr<SwapTxObject>> inactiveTransactions;
-    swapTransactions.reserve(transactions.size());
+    if (m_deferredTxChanges.defer(action, transactions))
+    {
+        return;
+    }
 
+    // swap coin settings are read here, objects may be built on the thread pool
+    std::vector<SwapTxData> swapTxs;
     for (const auto& t : transactions)
     {
         if (t.GetParameter<TxType>(TxParameterID::TransactionType) == TxType::AtomicSwap)
@@ -205,24 +220,60 @@ void SwapOffersViewModel::onTransactionsDataModelChanged(beam::wallet::ChangeAct
             auto swapCoinType = t.GetParameter<AtomicSwapCoin>(TxParameterID::AtomicSwapCoin);
             uint32_t minTxConfirmations = swapCoinType ? getTxMinConfirmations(*swapCoinType) : 0;
             double blocksPerHour = swapCoinType ? getBlocksPerHour(*swapCoinType) : 0;
-            auto newItem = make_shared<SwapTxObject>(t, minTxConfirmations, blocksPerHour);
-            swapTransactions.push_back(newItem);
-            if (!newItem->isPending() && newItem->isInProgress())
-            {
-                activeTransactions.push_back(newItem);
-            }
-            else
-            {
-                inactiveTransactions.push_back(newItem);
-            }
+            swapTxs.push_back({ t, getTxRow(t), minTxConfirmations, blocksPerHour });
         }
     }
 
-    if (swapTransactions.empty())
+    if (swapTxs.empty())
     {
         return;
     }
-    
+
+    m_deferredTxChanges.begin();
+    beamui::buildObjects<SwapTxObject>(this, std::move(swapTxs), [](const SwapTxData& data)
+    {
+        return make_shared<SwapTxObject>(data.tx, data.row, data.minTxConfirmations, data.blocksPerHour);
+    },
+    [this, action](vector<shared_ptr<SwapTxObject>>&& swapTransactions)
+    {
+        applySwapTransactions(action, swapTransactions);
+        m_deferredTxChanges.end([this](ChangeAction action, const std::vector<TxDescription>& items)
+        {
+            onTransactionsDataModelChanged(action, items);
+        });
+    });
+}
+
+TxRow::Ptr SwapOffersViewModel::getTxRow(const TxDescription& tx) const
+{
+    if (auto row = m_walletModel.getTxStore().getRow(tx.m_txId))
+    {
+        return row;
+    }
+
+    // removed transactions are not in the store anymore, they are matched by id only
+    auto row = std::make_shared<TxRow>();
+    row->txId = tx.m_txId;
+    row->txType = TxType::AtomicSwap;
+    return row;
+}
+
+void SwapOffersViewModel::applySwapTransactions(beam::wallet::ChangeAction action, const std::vector<std::shared_ptr<SwapTxObject>>& swapTransactions)
+{
+    vector<shared_ptr<SwapTxObject>> activeTransactions;
+    vector<shared_ptr<SwapTxObject>> inactiveTransactions;
+    for (const auto& tx : swapTransactions)
+    {
+        if (!tx->isPending() && tx->isInProgress())
+        {
+            activeTransactions.push_back(tx);
+        }
+        else
+        {
+            inactiveTransactions.push_back(tx);
+        }
+    }
+
     auto eraseActive = [this](auto tx)
     {
         if (m_activeTx.erase(tx->getTxID()) > 0) // item was erased
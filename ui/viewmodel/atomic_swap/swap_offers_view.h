@@ -23,6 +23,7 @@
 #include "swap_offers_list.h"
 #include "swap_tx_object_list.h"
 #include "viewmodel/currencies.h"
+#include "viewmodel/helpers/parallel_build.h"
 
 using namespace beam::wallet;
 
@@ -130,6 +131,9 @@ private:
     void incrementActiveTxCounter(AtomicSwapCoin swapCoinType);
     void decrementActiveTxCounter(AtomicSwapCoin swapCoinType);
     void resetActiveTxCounters();
+    // Row of @tx kept by TxStore
+    TxRow::Ptr getTxRow(const beam::wallet::TxDescription& tx) const;
+    void applySwapTransactions(beam::wallet::ChangeAction action, const std::vector<std::shared_ptr<SwapTxObject>>& swapTransactions);
 
     WalletModel& m_walletModel;
 
@@ -140,4 +144,5 @@ private:
 
     int m_activeTxCount = 0;
     std::map<beam::wallet::TxID, beam::wallet::AtomicSwapCoin> m_activeTx;
+    beamui::DeferredChanges<beam::wallet::TxDescription> m_deferredTxChanges;
 };
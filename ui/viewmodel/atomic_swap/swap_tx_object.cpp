@@ -111,8 +111,9 @@ namespace
     }
 }  // namespace
 
-SwapTxObject::SwapTxObject(const TxDescription& tx, uint32_t minTxConfirmations, double blocksPerHour, QObject* parent/* = nullptr*/)
-        : TxObject(tx, parent),
+SwapTxObject::SwapTxObject(const TxDescription& tx, TxRow::Ptr row, uint32_t minTxConfirmations, double blocksPerHour, QObject* parent/* = nullptr*/)
+        : TxObject(std::move(row), ExchangeRate::Currency::Unknown, nullptr, parent),
+          m_tx(tx),
           m_swapTx(tx),
           m_minTxConfirmations(minTxConfirmations),
           m_blocksPerHour(blocksPerHour)
@@ -260,7 +261,7 @@ QString SwapTxObject::getFee() const
     auto fee = m_swapTx.getFee();
     if (fee)
     {
-        Amount shieldedFee = GetShieldedFee(getTxDescription(), SubTxIndex::BEAM_LOCK_TX);
+        Amount shieldedFee = GetShieldedFee(m_tx, SubTxIndex::BEAM_LOCK_TX);
         return beamui::AmountInGrothToUIString(shieldedFee + *fee);
     }
     return QString();
@@ -303,9 +304,9 @@ QString SwapTxObject::getFailureReason() const
 
 QString SwapTxObject::getStateDetails() const
 {
-    if (getTxDescription().m_txType == beam::wallet::TxType::AtomicSwap)
+    if (m_tx.m_txType == beam::wallet::TxType::AtomicSwap)
     {
-        switch (getTxDescription().m_status)
+        switch (m_tx.m_status)
         {
         case beam::wallet::TxStatus::Pending:
         case beam::wallet::TxStatus::InProgress:
@@ -354,7 +355,7 @@ beam::wallet::AtomicSwapCoin SwapTxObject::getSwapCoinType() const
 
 auto SwapTxObject::getStatus() const -> QString
 {
-    SwapTxStatusInterpreter interpreter(getTxDescription());
+    SwapTxStatusInterpreter interpreter(m_tx);
     return interpreter.getStatus().c_str();
 }
 
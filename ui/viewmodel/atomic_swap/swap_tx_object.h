@@ -22,7 +22,8 @@ class SwapTxObject : public TxObject
     Q_OBJECT
 
 public:
-    SwapTxObject(const beam::wallet::TxDescription& tx, uint32_t minTxConfirmations, double blocksPerHour, QObject* parent = nullptr);
+    // @row is the projection of @tx kept by TxStore
+    SwapTxObject(const beam::wallet::TxDescription& tx, TxRow::Ptr row, uint32_t minTxConfirmations, double blocksPerHour, QObject* parent = nullptr);
     bool operator==(const SwapTxObject& other) const;
 
     auto getSentAmountWithCurrency() const -> QString;
@@ -48,7 +49,7 @@ public:
     auto getFailureReason() const -> QString override;
     QString getStateDetails() const override;
     beam::wallet::AtomicSwapCoin getSwapCoinType() const;
-    auto getStatus() const -> QString override;
+    auto getStatus() const -> QString;
     QString getAmountWithCurrency() const;
 
     bool isLockTxProofReceived() const;
@@ -70,6 +71,7 @@ private:
     auto getSwapAmountValue(bool sent) const -> beam::Amount;
     auto getSwapAmountWithCurrency(bool sent) const -> QString;
 
+    beam::wallet::TxDescription m_tx;
     beam::wallet::SwapTxDescription m_swapTx;
     uint32_t m_minTxConfirmations = 0;
     double m_blocksPerHour = 0;
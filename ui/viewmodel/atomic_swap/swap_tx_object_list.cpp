@@ -19,6 +19,11 @@ SwapTxObjectList::SwapTxObjectList()
 {
 }
 
+auto SwapTxObjectList::getItemKey(const std::shared_ptr<SwapTxObject>& item) const -> beam::wallet::TxID
+{
+    return item->getTxID();
+}
+
 auto SwapTxObjectList::roleNames() const -> QHash<int, QByteArray>
 {
     static const auto roles = QHash<int, QByteArray>
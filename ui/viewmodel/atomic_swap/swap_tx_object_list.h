@@ -18,7 +18,7 @@
 #include "viewmodel/helpers/list_model.h"
 #include <QLocale>
 
-class SwapTxObjectList : public ListModel<std::shared_ptr<SwapTxObject>>
+class SwapTxObjectList : public KeyedListModel<std::shared_ptr<SwapTxObject>, beam::wallet::TxID>
 {
 
     Q_OBJECT
@@ -91,6 +91,9 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+protected:
+    beam::wallet::TxID getItemKey(const std::shared_ptr<SwapTxObject>& item) const override;
+
 private:
     QLocale m_locale; // default locale
 };
@@ -0,0 +1,83 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "delivery_stats_view.h"
+#include "model/app_model.h"
+
+namespace
+{
+    const int kRefreshIntervalMs = 1000;
+
+    QVariantMap toVariant(const beamui::LatencyHistogram& histogram)
+    {
+        QVariantMap map;
+        map["count"] = static_cast<qulonglong>(histogram.getCount());
+        map["p50"] = static_cast<qulonglong>(histogram.getPercentile(50));
+        map["p95"] = static_cast<qulonglong>(histogram.getPercentile(95));
+        map["p99"] = static_cast<qulonglong>(histogram.getPercentile(99));
+        map["max"] = static_cast<qulonglong>(histogram.getMax());
+        return map;
+    }
+}  // namespace
+
+DeliveryStatsViewModel::DeliveryStatsViewModel()
+    : m_model(*AppModel::getInstance().getWalletModel())
+{
+    m_refreshTimer.setInterval(kRefreshIntervalMs);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &DeliveryStatsViewModel::statsChanged);
+    m_refreshTimer.start();
+
+    if (auto watchdog = AppModel::getInstance().getUiWatchdog())
+    {
+        connect(watchdog, &UiWatchdog::stallDetected, this, &DeliveryStatsViewModel::stallsChanged);
+    }
+}
+
+QVariantList DeliveryStatsViewModel::getStats() const
+{
+    QVariantList stats;
+    for (const auto& entry : m_model.getDeliveryStats().getEntries())
+    {
+        QVariantMap item;
+        item["name"] = QString::fromStdString(entry.name);
+        // microseconds
+        item["queue"] = toVariant(entry.queue);
+        item["handler"] = toVariant(entry.handler);
+        stats.push_back(item);
+    }
+    return stats;
+}
+
+QVariantList DeliveryStatsViewModel::getStalls() const
+{
+    QVariantList stalls;
+    if (auto watchdog = AppModel::getInstance().getUiWatchdog())
+    {
+        for (const auto& stall : watchdog->getStalls())
+        {
+            QVariantMap item;
+            item["time"] = stall.time;
+            item["durationMs"] = stall.durationMs;
+            item["activity"] = stall.activity;
+            stalls.push_back(item);
+        }
+    }
+    return stalls;
+}
+
+void DeliveryStatsViewModel::reset()
+{
+    m_model.resetDeliveryStats();
+    emit statsChanged();
+}
@@ -0,0 +1,46 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QVariantList>
+#include "model/wallet_model.h"
+
+//
+// Debug view of the UI responsiveness: wallet callbacks delivery times, see beamui::DeliveryStats,
+// and UI thread stalls, see UiWatchdog
+//
+class DeliveryStatsViewModel : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QVariantList stats   READ getStats   NOTIFY statsChanged)
+    Q_PROPERTY(QVariantList stalls  READ getStalls  NOTIFY stallsChanged)
+
+public:
+    DeliveryStatsViewModel();
+
+    QVariantList getStats() const;
+    QVariantList getStalls() const;
+
+    Q_INVOKABLE void reset();
+
+signals:
+    void statsChanged();
+    void stallsChanged();
+
+private:
+    WalletModel& m_model;
+    QTimer m_refreshTimer;
+};
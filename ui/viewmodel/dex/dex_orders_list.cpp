@@ -14,6 +14,17 @@ DexOrdersList::DexOrdersList()
 {
 }
 
+beam::wallet::DexOrderID DexOrdersList::getItemKey(const beam::wallet::DexOrder& order) const
+{
+    return order.orderID;
+}
+
+bool DexOrdersList::isItemChanged(const beam::wallet::DexOrder& stored, const beam::wallet::DexOrder& order) const
+{
+    // fields shown by the rows
+    return stored.sellCoin != order.sellCoin || stored.amount != order.amount || stored.isMy != order.isMy;
+}
+
 QHash<int, QByteArray> DexOrdersList::roleNames() const
 {
     static const auto roles = QHash<int, QByteArray>
@@ -15,7 +15,7 @@
 #include "viewmodel/helpers/list_model.h"
 #include "wallet/client/extensions/dex_board/dex_order.h"
 
-class DexOrdersList : public ListModel<beam::wallet::DexOrder>
+class DexOrdersList : public KeyedListModel<beam::wallet::DexOrder, beam::wallet::DexOrderID>
 {
     Q_OBJECT
 public:
@@ -41,4 +41,8 @@ public:
 
     // TODO:DEX refactor and hide
     beam::wallet::PeerID selfID;
+
+protected:
+    beam::wallet::DexOrderID getItemKey(const beam::wallet::DexOrder& order) const override;
+    bool isItemChanged(const beam::wallet::DexOrder& stored, const beam::wallet::DexOrder& order) const override;
 };
@@ -79,7 +79,7 @@ namespace beamui::dex
         switch (action)
         {
             case ChangeAction::Reset:
-                _orders.reset(orders);
+                _orders.reconcile(orders);
                 break;
 
             case ChangeAction::Added:
@@ -14,12 +14,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <type_traits>
 
 #include <QAbstractListModel>
 Q_DECLARE_METATYPE(QModelIndex)
+
+//
+// Storage and notifications shared by the list models. Mutators are protected,
+// derived models decide how items are matched: by value in ListModel, by key in KeyedListModel.
+//
 template <typename T>
-class ListModel : public QAbstractListModel
+class ListModelBase : public QAbstractListModel
 {
     template<typename Y>
     struct Comparator
@@ -37,7 +47,7 @@ class ListModel : public QAbstractListModel
         constexpr bool operator()(const std::shared_ptr<Y>& other) { return *value == *other; }
     };
 public:
-    ListModel(QObject* pObj = nullptr)
+    ListModelBase(QObject* pObj = nullptr)
         : QAbstractListModel(pObj)
     {
     }
@@ -51,10 +61,38 @@ public:
         return m_list.size();
     }
 
+    T get(int index) const
+    {
+        return m_list.at(index);
+    }
+
+    auto begin()
+    {
+        return m_list.begin();
+    }
+
+    auto end()
+    {
+        return m_list.end();
+    }
+
+    bool touch(int index)
+    {
+        if (index < 0 || index >= m_list.size())
+        {
+            return false;
+        }
+
+        const auto qindex = createIndex(index, 0);
+        emit dataChanged(qindex, qindex);
+        return true;
+    }
+
+protected:
     void insert(const T& item)
     {
         int row = m_list.size();
-        beginInsertRows(QModelIndex(), row,row + 1);
+        beginInsertRows(QModelIndex(), row, row);
         m_list.push_back(item);
         endInsertRows();
     }
@@ -86,73 +124,358 @@ public:
         endResetModel();
     }
 
-    T get(int index) const
-    {
-        return m_list.at(index);
-    }
-
     void remove(const std::vector<T>& items)
     {
+        std::vector<int> rows;
         for (const auto& item : items)
         {
             auto it = std::find_if(std::begin(m_list), std::end(m_list), Comparator<T>(item));
 
             if (it != std::end(m_list))
             {
-                auto index = m_list.indexOf(*it);
-                beginRemoveRows(QModelIndex(), index, index);
-                m_list.removeAt(index);
-                endRemoveRows();
+                rows.push_back(int(std::distance(std::begin(m_list), it)));
             }
         }
+        removeRowRanges(std::move(rows));
     }
 
     void update(const std::vector<T>& items)
     {
+        std::vector<int> rows;
+        std::vector<T> added;
         for (const auto& item : items)
         {
             auto it = std::find_if(std::begin(m_list), std::end(m_list), Comparator<T>(item));
 
-            // index to add item on last position by default
-            int index = (m_list.count() == 0) ? 0 : m_list.count() - 1;
-
             if (it != std::end(m_list))
             {
-                index = m_list.indexOf(*it);
+                *it = item;
+                rows.push_back(int(std::distance(std::begin(m_list), it)));
+            }
+            else
+            {
+                added.push_back(item);
+            }
+        }
+        touchRows(std::move(rows));
+        insert(added);
+    }
+
+    // Emits single dataChanged for every contiguous range of rows
+    void touchRows(std::vector<int> rows)
+    {
+        forEachRange(rows, [this](int first, int last)
+        {
+            emit dataChanged(createIndex(first, 0), createIndex(last, 0));
+        });
+    }
+
+    // Removes rows with single beginRemoveRows/endRemoveRows per contiguous range
+    void removeRowRanges(std::vector<int> rows)
+    {
+        std::vector<std::pair<int, int>> ranges;
+        forEachRange(rows, [&ranges](int first, int last)
+        {
+            ranges.emplace_back(first, last);
+        });
+
+        // remove from the bottom, so ranges above are not shifted
+        for (auto it = ranges.rbegin(); it != ranges.rend(); ++it)
+        {
+            beginRemoveRows(QModelIndex(), it->first, it->second);
+            m_list.erase(m_list.begin() + it->first, m_list.begin() + it->second + 1);
+            endRemoveRows();
+        }
+    }
 
-                beginRemoveRows(QModelIndex(), index, index);
-                m_list.removeAt(index);
-                endRemoveRows();
+    template <typename Func>
+    static void forEachRange(std::vector<int>& rows, Func&& func)
+    {
+        if (rows.empty())
+        {
+            return;
+        }
+
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+        int first = rows.front();
+        int last = first;
+        for (size_t i = 1; i < rows.size(); ++i)
+        {
+            if (rows[i] != last + 1)
+            {
+                func(first, last);
+                first = rows[i];
             }
+            last = rows[i];
+        }
+        func(first, last);
+    }
+
+    QList<T> m_list;
+};
+
+template <typename T>
+class ListModel : public ListModelBase<T>
+{
+public:
+    ListModel(QObject* pObj = nullptr)
+        : ListModelBase<T>(pObj)
+    {
+    }
+
+    using ListModelBase<T>::insert;
+    using ListModelBase<T>::reset;
+    using ListModelBase<T>::remove;
+    using ListModelBase<T>::update;
+};
+
+// Hashes keys as raw bytes, suitable for TxID, uintBig and plain integers
+template <typename Key>
+struct ListModelKeyHash
+{
+    static_assert(std::is_trivially_copyable<Key>::value, "Key should be trivially copyable");
 
-            beginInsertRows(QModelIndex(), index, index);
-            m_list.insert(index, item);
-            endInsertRows();
+    size_t operator()(const Key& key) const noexcept
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        const auto* p = reinterpret_cast<const unsigned char*>(&key);
+        for (size_t i = 0; i < sizeof(Key); ++i)
+        {
+            hash ^= p[i];
+            hash *= 1099511628211ULL;
         }
+        return static_cast<size_t>(hash);
     }
+};
 
-    auto begin()
+//
+// List model which keeps key -> row index, so keyed
+// update/remove do not scan the whole list for every item.
+// Index is rebuilt lazily starting from the first row shifted by removal.
+// Unkeyed mutators of the base are not accessible, so the index can't be bypassed.
+//
+template <typename T, typename Key, typename KeyHash = ListModelKeyHash<Key>>
+class KeyedListModel : public ListModelBase<T>
+{
+public:
+    KeyedListModel(QObject* pObj = nullptr)
+        : ListModelBase<T>(pObj)
     {
-        return m_list.begin();
     }
 
-    auto end()
+    void insert(const T& item)
     {
-        return m_list.end();
+        insert(std::vector<T>{item});
     }
 
-    bool touch(int index)
+    void insert(const std::vector<T>& items)
     {
-        if (index < 0 || index >= m_list.size())
+        if (items.empty())
         {
-            return false;
+            return;
         }
 
-        const auto qindex = createIndex(index, 0);
-        emit dataChanged(qindex, qindex);
-        return true;
+        const int row = m_list.size();
+        this->beginInsertRows(QModelIndex(), row, row + int(items.size()) - 1);
+        for (const auto& item : items)
+        {
+            m_list.push_back(item);
+            onItemStored(item);
+        }
+        indexTail();
+        this->endInsertRows();
+    }
+
+    void reset(const std::vector<T>& items)
+    {
+        this->beginResetModel();
+        onItemsReset();
+        m_list.clear();
+        m_list.reserve(int(items.size()));
+        for (const auto& item : items)
+        {
+            m_list.push_back(item);
+            onItemStored(item);
+        }
+        m_index.clear();
+        m_indexed = 0;
+        indexTail();
+        this->endResetModel();
+    }
+
+    void remove(const std::vector<T>& items)
+    {
+        std::vector<int> rows;
+        rows.reserve(items.size());
+        for (const auto& item : items)
+        {
+            const auto key = getItemKey(item);
+            const int row = indexOf(key);
+            if (row >= 0)
+            {
+                rows.push_back(row);
+                m_index.erase(key);
+                onItemChanged(key);
+            }
+        }
+
+        if (rows.empty())
+        {
+            return;
+        }
+
+        const int firstRow = *std::min_element(rows.begin(), rows.end());
+        this->removeRowRanges(std::move(rows));
+        m_indexed = std::min(m_indexed, firstRow);
+    }
+
+    // Replaces existing rows in place and appends unknown items.
+    // Replaced rows keep their position, so views get single dataChanged
+    // per contiguous range instead of remove/insert pair per item.
+    // Several unknown items with the same key are added once, the last one wins.
+    void update(const std::vector<T>& items)
+    {
+        std::vector<int> rows;
+        rows.reserve(items.size());
+        std::vector<T> added;
+        std::unordered_map<Key, size_t, KeyHash> addedIndex;
+        for (const auto& item : items)
+        {
+            const auto key = getItemKey(item);
+            const int row = indexOf(key);
+            if (row < 0)
+            {
+                const auto it = addedIndex.emplace(key, added.size());
+                if (it.second)
+                {
+                    added.push_back(item);
+                }
+                else
+                {
+                    added[it.first->second] = item;
+                }
+                continue;
+            }
+
+            // same key stays on the same row, index is not affected
+            m_list[row] = item;
+            rows.push_back(row);
+            onItemChanged(key);
+            onItemStored(item);
+        }
+        this->touchRows(std::move(rows));
+        insert(added);
+    }
+
+    // Applies full snapshot with minimal set of changes instead of model reset:
+    // rows missing in the snapshot are removed, known rows are replaced in place
+    // if isItemChanged() says so and new items are appended. Views keep their state (scroll, selection).
+    // Only rows accepted by @inScope are compared with the snapshot,
+    // this allows several snapshot sources to share one list.
+    template <typename Scope>
+    void reconcile(const std::vector<T>& items, Scope&& inScope)
+    {
+        if (m_list.isEmpty())
+        {
+            // nothing to preserve, keep modelReset for the first snapshot
+            reset(items);
+            return;
+        }
+
+        std::unordered_set<Key, KeyHash> keys;
+        keys.reserve(items.size());
+        for (const auto& item : items)
+        {
+            keys.insert(getItemKey(item));
+        }
+
+        std::vector<int> rows;
+        for (int row = 0; row < m_list.size(); ++row)
+        {
+            const auto& item = m_list[row];
+            if (!inScope(item))
+            {
+                continue;
+            }
+
+            const auto key = getItemKey(item);
+            if (keys.find(key) == keys.end())
+            {
+                rows.push_back(row);
+            }
+        }
+
+        if (!rows.empty())
+        {
+            // rows are already sorted
+            indexTail();
+            for (auto row : rows)
+            {
+                const auto key = getItemKey(m_list[row]);
+                m_index.erase(key);
+                onItemChanged(key);
+            }
+            m_indexed = std::min(m_indexed, rows.front());
+            this->removeRowRanges(std::move(rows));
+        }
+
+        std::vector<T> changed;
+        changed.reserve(items.size());
+        for (const auto& item : items)
+        {
+            const int row = indexOf(getItemKey(item));
+            if (row < 0 || isItemChanged(m_list[row], item))
+            {
+                changed.push_back(item);
+            }
+        }
+        update(changed);
+    }
+
+    void reconcile(const std::vector<T>& items)
+    {
+        reconcile(items, [](const T&) { return true; });
+    }
+
+    int indexOf(const Key& key) const
+    {
+        indexTail();
+        const auto it = m_index.find(key);
+        return it != m_index.end() ? it->second : -1;
     }
 
 protected:
-    QList<T> m_list;
+    virtual Key getItemKey(const T& item) const = 0;
+
+    // Tells reconcile() whether the stored item differs from the snapshot item with the same key,
+    // rows of unchanged items are neither replaced nor touched
+    virtual bool isItemChanged(const T& /*stored*/, const T& /*item*/) const
+    {
+        return true;
+    }
+
+    // Notifies derived models that item with @key was replaced or removed,
+    // e.g. to drop data cached for it
+    virtual void onItemChanged(const Key&) {}
+    virtual void onItemsReset() {}
+    // Notifies derived models that @item was put to the list (inserted or replaced existing one)
+    virtual void onItemStored(const T&) {}
+
+    using ListModelBase<T>::m_list;
+
+private:
+    void indexTail() const
+    {
+        for (; m_indexed < m_list.size(); ++m_indexed)
+        {
+            m_index[getItemKey(m_list[m_indexed])] = m_indexed;
+        }
+    }
+
+    mutable std::unordered_map<Key, int, KeyHash> m_index;
+    // rows [0, m_indexed) have valid entries in m_index
+    mutable int m_indexed = 0;
 };
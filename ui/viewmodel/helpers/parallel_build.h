@@ -0,0 +1,171 @@
+// Copyright 2020 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QPointer>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "wallet/client/wallet_client.h"
+
+namespace beamui
+{
+    // batches smaller than this are built in place, thread hops cost more
+    constexpr size_t kMinParallelBuildSize = 1024;
+    constexpr size_t kMinParallelChunkSize = 256;
+
+    namespace details
+    {
+        class FunctionRunnable : public QRunnable
+        {
+        public:
+            explicit FunctionRunnable(std::function<void()> func)
+                : m_func(std::move(func))
+            {
+            }
+
+            void run() override
+            {
+                m_func();
+            }
+
+        private:
+            std::function<void()> m_func;
+        };
+    }  // namespace details
+
+    //
+    // Creates @make(item) for every item and passes the objects, in the order of items, to @done.
+    // Large batches are split into chunks built on the global QThreadPool, finished objects are moved
+    // to the thread of @receiver and @done is called there from the event loop, unless @receiver is gone.
+    // Small batches are built in place and @done is called before return.
+    // @make is called concurrently and must not touch UI state.
+    //
+    template <typename Object, typename Item, typename Make, typename Done>
+    void buildObjects(QObject* receiver, std::vector<Item>&& items, Make make, Done done)
+    {
+        using Objects = std::vector<std::shared_ptr<Object>>;
+
+        auto* pool = QThreadPool::globalInstance();
+        if (items.size() < kMinParallelBuildSize || pool->maxThreadCount() < 2)
+        {
+            Objects objects;
+            objects.reserve(items.size());
+            for (const auto& item : items)
+            {
+                objects.push_back(make(item));
+            }
+            done(std::move(objects));
+            return;
+        }
+
+        struct State
+        {
+            std::vector<Item> items;
+            Objects objects;
+            std::atomic<size_t> chunksLeft;
+            QThread* target;
+            QPointer<QObject> receiver;
+            Done done;
+        };
+
+        const auto count = items.size();
+        const auto chunkSize = std::max(kMinParallelChunkSize, count / (static_cast<size_t>(pool->maxThreadCount()) * 4) + 1);
+        const auto chunks = (count + chunkSize - 1) / chunkSize;
+
+        auto state = std::shared_ptr<State>(new State{ std::move(items), Objects(count), {chunks}, receiver->thread(), receiver, std::move(done) });
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const auto first = chunk * chunkSize;
+            const auto last = std::min(count, first + chunkSize);
+            pool->start(new details::FunctionRunnable([state, first, last, make]()
+            {
+                for (auto i = first; i < last; ++i)
+                {
+                    auto object = make(state->items[i]);
+                    object->moveToThread(state->target);
+                    state->objects[i] = std::move(object);
+                }
+
+                if (--state->chunksLeft == 0)
+                {
+                    QMetaObject::invokeMethod(QCoreApplication::instance(), [state]()
+                    {
+                        if (state->receiver)
+                        {
+                            state->done(std::move(state->objects));
+                        }
+                    }, Qt::QueuedConnection);
+                }
+            }));
+        }
+    }
+
+    //
+    // Keeps wallet changes in order while an earlier change is built asynchronously:
+    // changes which arrive in between are queued and replayed after it is applied
+    //
+    template <typename T>
+    class DeferredChanges
+    {
+    public:
+        using ChangeAction = beam::wallet::ChangeAction;
+
+        // Returns true if the change is queued and must not be applied now
+        bool defer(ChangeAction action, const std::vector<T>& items)
+        {
+            if (!m_busy)
+            {
+                return false;
+            }
+            m_queue.emplace_back(action, items);
+            return true;
+        }
+
+        bool isBusy() const
+        {
+            return m_busy;
+        }
+
+        void begin()
+        {
+            m_busy = true;
+        }
+
+        // Passes queued changes to @apply in arrival order until one of them starts a new build
+        template <typename Apply>
+        void end(Apply&& apply)
+        {
+            m_busy = false;
+            while (!m_busy && !m_queue.empty())
+            {
+                auto change = std::move(m_queue.front());
+                m_queue.pop_front();
+                apply(change.first, change.second);
+            }
+        }
+
+    private:
+        bool m_busy = false;
+        std::deque<std::pair<ChangeAction, std::vector<T>>> m_queue;
+    };
+}  // namespace beamui
@@ -0,0 +1,190 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <QString>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "list_model.h"
+
+//
+// Result of a search query. Rows are checked by the keys of their items,
+// so the result stays valid while the rows are moved
+//
+class SearchMatches
+{
+public:
+    virtual ~SearchMatches() = default;
+
+    virtual bool containsRow(int row) const = 0;
+};
+
+//
+// Implemented by source models which can answer substring queries
+// for the search role without scanning all rows, see SortFilterProxyModel
+//
+class SearchIndexProvider
+{
+public:
+    virtual ~SearchIndexProvider() = default;
+
+    virtual bool isSearchRole(int role) const = 0;
+    // Changes every time indexed rows change, matches obtained before are stale then
+    virtual uint64_t getSearchRevision() const = 0;
+    // Finds rows which contain @query (case insensitive)
+    virtual std::shared_ptr<const SearchMatches> search(const QString& query) const = 0;
+};
+
+//
+// Case insensitive substring index. Every text is split into trigrams,
+// query is checked only against rows from the shortest posting list of its trigrams.
+// Removed rows leave stale slots in posting lists, they are skipped on lookup
+// and dropped when the index is compacted.
+//
+template <typename Key, typename KeyHash = ListModelKeyHash<Key>>
+class SearchIndex
+{
+public:
+    void set(const Key& key, const QString& text)
+    {
+        remove(key);
+
+        const auto slot = static_cast<uint32_t>(m_docs.size());
+        m_docs.push_back({ key, text.toCaseFolded(), true });
+        m_slots[key] = slot;
+
+        const auto& folded = m_docs.back().text;
+        std::unordered_set<uint64_t> trigrams;
+        for (int i = 0; i + 2 < folded.size(); ++i)
+        {
+            trigrams.insert(getTrigram(folded, i));
+        }
+        for (auto trigram : trigrams)
+        {
+            m_postings[trigram].push_back(slot);
+        }
+    }
+
+    void remove(const Key& key)
+    {
+        const auto it = m_slots.find(key);
+        if (it == m_slots.end())
+        {
+            return;
+        }
+
+        auto& doc = m_docs[it->second];
+        doc.alive = false;
+        doc.text.clear();
+        m_slots.erase(it);
+
+        if (++m_dead > kMinDeadToCompact && m_dead > m_slots.size())
+        {
+            compact();
+        }
+    }
+
+    bool contains(const Key& key) const
+    {
+        return m_slots.find(key) != m_slots.end();
+    }
+
+    void clear()
+    {
+        m_docs.clear();
+        m_slots.clear();
+        m_postings.clear();
+        m_dead = 0;
+    }
+
+    template <typename Func>
+    void find(const QString& query, Func&& onMatch) const
+    {
+        const auto folded = query.toCaseFolded();
+        if (folded.size() < 3)
+        {
+            // too short for trigrams, still cheaper than formatting rows
+            for (const auto& doc : m_docs)
+            {
+                if (doc.alive && doc.text.contains(folded))
+                {
+                    onMatch(doc.key);
+                }
+            }
+            return;
+        }
+
+        const std::vector<uint32_t>* candidates = nullptr;
+        for (int i = 0; i + 2 < folded.size(); ++i)
+        {
+            const auto it = m_postings.find(getTrigram(folded, i));
+            if (it == m_postings.end())
+            {
+                return;
+            }
+            if (!candidates || it->second.size() < candidates->size())
+            {
+                candidates = &it->second;
+            }
+        }
+
+        for (auto slot : *candidates)
+        {
+            const auto& doc = m_docs[slot];
+            if (doc.alive && doc.text.contains(folded))
+            {
+                onMatch(doc.key);
+            }
+        }
+    }
+
+private:
+    static uint64_t getTrigram(const QString& text, int pos)
+    {
+        return (uint64_t(text[pos].unicode()) << 32)
+             | (uint64_t(text[pos + 1].unicode()) << 16)
+             |  uint64_t(text[pos + 2].unicode());
+    }
+
+    void compact()
+    {
+        std::vector<Doc> docs;
+        docs.swap(m_docs);
+        clear();
+        for (auto& doc : docs)
+        {
+            if (doc.alive)
+            {
+                set(doc.key, doc.text);
+            }
+        }
+    }
+
+    struct Doc
+    {
+        Key key;
+        QString text;
+        bool alive;
+    };
+
+    static constexpr size_t kMinDeadToCompact = 1024;
+
+    std::vector<Doc> m_docs;
+    std::unordered_map<Key, uint32_t, KeyHash> m_slots;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_postings;
+    size_t m_dead = 0;
+};
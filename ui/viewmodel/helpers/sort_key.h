@@ -0,0 +1,82 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <QString>
+#include <cstdint>
+
+//
+// Typed sort value, compared without QVariant conversions
+//
+struct SortKey
+{
+    enum class Type : uint8_t
+    {
+        None,
+        Number,
+        Text
+    };
+
+    static SortKey fromUnsigned(uint64_t value)
+    {
+        SortKey key;
+        key.type = Type::Number;
+        key.number = value;
+        return key;
+    }
+
+    static SortKey fromSigned(int64_t value)
+    {
+        // shift to unsigned range keeping the order
+        return fromUnsigned(static_cast<uint64_t>(value) ^ (uint64_t(1) << 63));
+    }
+
+    static SortKey fromText(const QString& value)
+    {
+        SortKey key;
+        key.type = Type::Text;
+        key.text = value;
+        return key;
+    }
+
+    bool lessThan(const SortKey& other, Qt::CaseSensitivity cs) const
+    {
+        if (type != other.type)
+        {
+            return type < other.type;
+        }
+        if (type == Type::Text)
+        {
+            return text.compare(other.text, cs) < 0;
+        }
+        return number < other.number;
+    }
+
+    Type type = Type::None;
+    uint64_t number = 0;
+    QString text;
+};
+
+//
+// Implemented by source models which can provide typed sort keys, see SortFilterProxyModel
+//
+class SortKeyProvider
+{
+public:
+    virtual ~SortKeyProvider() = default;
+
+    // Returns false if @role has no typed key, QVariant comparison is used then
+    virtual bool getSortKey(int row, int role, SortKey& key) const = 0;
+};
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include "sortfilterproxymodel.h"
+#include "search_index.h"
+#include "model/ui_watchdog.h"
+#include <algorithm>
 
 SortFilterProxyModel::SortFilterProxyModel(QObject *parent) 
     : QSortFilterProxyModel(parent)
@@ -39,6 +42,107 @@ void SortFilterProxyModel::setSource(QObject *source)
     setSourceModel(qobject_cast<QAbstractItemModel *>(source));
 }
 
+void SortFilterProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    m_roleKeys.clear();
+    m_sortKeyProvider = dynamic_cast<const SortKeyProvider*>(sourceModel);
+    m_searchIndexProvider = dynamic_cast<const SearchIndexProvider*>(sourceModel);
+    m_searchMatches.reset();
+    m_searchValid = false;
+    clearSortKeys();
+    clearPredicateMatches(~uint32_t(0));
+
+    // connect before the base class, cached keys should be updated
+    // before QSortFilterProxyModel handles the change and compares rows
+    connectSource(sourceModel);
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
+namespace
+{
+    template <typename T>
+    void insertRows(std::vector<T>& cache, int first, int last)
+    {
+        if (first < static_cast<int>(cache.size()))
+            cache.insert(cache.begin() + first, static_cast<size_t>(last - first + 1), T());
+    }
+
+    template <typename T>
+    void removeRows(std::vector<T>& cache, int first, int last)
+    {
+        const int size = static_cast<int>(cache.size());
+        if (first < size)
+            cache.erase(cache.begin() + first, cache.begin() + std::min(last + 1, size));
+    }
+
+    bool matchesValue(const QVariant& rowValue, const QVariant& value)
+    {
+        if (rowValue.type() == QVariant::List)
+            return rowValue.toList().contains(value);
+        return rowValue == value;
+    }
+
+    const size_t kMaxPredicates = 32;
+}
+
+void SortFilterProxyModel::connectSource(QAbstractItemModel *source)
+{
+    for (const auto& connection : m_sourceConnections)
+        disconnect(connection);
+    m_sourceConnections.clear();
+
+    if (!source)
+        return;
+
+    m_sourceConnections << connect(source, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &parent, int first, int last) {
+        if (parent.isValid())
+            return;
+        insertRows(m_sortKeys, first, last);
+        insertRows(m_sortKeyValid, first, last);
+        insertRows(m_predicatesEvaluated, first, last);
+        insertRows(m_predicatesMatched, first, last);
+    });
+    m_sourceConnections << connect(source, &QAbstractItemModel::rowsRemoved, this, [this](const QModelIndex &parent, int first, int last) {
+        if (parent.isValid())
+            return;
+        removeRows(m_sortKeys, first, last);
+        removeRows(m_sortKeyValid, first, last);
+        removeRows(m_predicatesEvaluated, first, last);
+        removeRows(m_predicatesMatched, first, last);
+    });
+    m_sourceConnections << connect(source, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &topLeft, const QModelIndex &bottomRight) {
+        for (int row = topLeft.row(); row <= bottomRight.row() && row < static_cast<int>(m_sortKeyValid.size()); ++row)
+            m_sortKeyValid[row] = 0;
+        for (int row = topLeft.row(); row <= bottomRight.row() && row < static_cast<int>(m_predicatesEvaluated.size()); ++row)
+            m_predicatesEvaluated[row] = 0;
+    });
+
+    const auto clearCaches = [this]() {
+        clearSortKeys();
+        clearPredicateMatches(~uint32_t(0));
+    };
+    m_sourceConnections << connect(source, &QAbstractItemModel::rowsMoved, this, clearCaches);
+    m_sourceConnections << connect(source, &QAbstractItemModel::layoutChanged, this, clearCaches);
+    m_sourceConnections << connect(source, &QAbstractItemModel::modelReset, this, clearCaches);
+}
+
+void SortFilterProxyModel::clearSortKeys()
+{
+    m_sortKeys.clear();
+    m_sortKeyValid.clear();
+}
+
+void SortFilterProxyModel::clearPredicateMatches(uint32_t slots)
+{
+    if (slots == ~uint32_t(0)) {
+        m_predicatesEvaluated.clear();
+        m_predicatesMatched.clear();
+        return;
+    }
+    for (auto& evaluated : m_predicatesEvaluated)
+        evaluated &= ~slots;
+}
+
 QByteArray SortFilterProxyModel::sortRole() const
 {
     return m_sortRole;
@@ -48,13 +152,23 @@ void SortFilterProxyModel::setSortRole(const QByteArray &role)
 {
     if (m_sortRole != role) {
         m_sortRole = role;
-        if (m_complete)
-            QSortFilterProxyModel::setSortRole(roleKey(role));
+        if (m_complete) {
+            const int key = roleKey(role);
+            if (key != QSortFilterProxyModel::sortRole()) {
+                UiWatchdog::Activity activity("SortFilterProxyModel::sort");
+                clearSortKeys();
+                QSortFilterProxyModel::setSortRole(key);
+            }
+        }
     }
 }
 
 void SortFilterProxyModel::setSortOrder(Qt::SortOrder order)
 {
+    // keep the current mapping if nothing changes, sort() always re-sorts all rows
+    if (sortColumn() == 0 && sortOrder() == order)
+        return;
+    UiWatchdog::Activity activity("SortFilterProxyModel::sort");
     QSortFilterProxyModel::sort(0, order);
 }
 
@@ -79,6 +193,7 @@ QString SortFilterProxyModel::filterString() const
 
 void SortFilterProxyModel::setFilterString(const QString &filter)
 {
+    UiWatchdog::Activity activity("SortFilterProxyModel::filter");
     setFilterRegExp(QRegExp(filter, filterCaseSensitivity(), static_cast<QRegExp::PatternSyntax>(filterSyntax())));
 }
 
@@ -92,6 +207,102 @@ void SortFilterProxyModel::setFilterSyntax(SortFilterProxyModel::FilterSyntax sy
     setFilterRegExp(QRegExp(filterString(), filterCaseSensitivity(), static_cast<QRegExp::PatternSyntax>(syntax)));
 }
 
+QVariantMap SortFilterProxyModel::filters() const
+{
+    QVariantMap filters;
+    for (const auto& predicate : m_predicates) {
+        if (!predicate.role.isEmpty())
+            filters.insert(QString::fromUtf8(predicate.role), predicate.value);
+    }
+    return filters;
+}
+
+void SortFilterProxyModel::setFilters(const QVariantMap& filters)
+{
+    // keep slots of unchanged predicates, so only changed ones are re-evaluated
+    uint32_t changed = 0;
+    for (size_t slot = 0; slot < m_predicates.size(); ++slot) {
+        auto& predicate = m_predicates[slot];
+        if (predicate.role.isEmpty())
+            continue;
+        const auto it = filters.find(QString::fromUtf8(predicate.role));
+        if (it == filters.end()) {
+            predicate = Predicate();
+            changed |= 1u << slot;
+        } else if (it.value() != predicate.value) {
+            predicate.value = it.value();
+            changed |= 1u << slot;
+        }
+    }
+
+    for (auto it = filters.begin(); it != filters.end(); ++it) {
+        const auto role = it.key().toUtf8();
+        const auto existing = std::find_if(m_predicates.begin(), m_predicates.end(), [&role](const Predicate& p) {
+            return p.role == role;
+        });
+        if (existing != m_predicates.end())
+            continue;
+
+        auto slot = std::find_if(m_predicates.begin(), m_predicates.end(), [](const Predicate& p) {
+            return p.role.isEmpty();
+        });
+        if (slot == m_predicates.end()) {
+            if (m_predicates.size() == kMaxPredicates) {
+                qWarning("SortFilterProxyModel: too many filters, '%s' is ignored", role.constData());
+                continue;
+            }
+            slot = m_predicates.insert(m_predicates.end(), Predicate());
+        }
+        slot->role = role;
+        slot->value = it.value();
+        changed |= 1u << std::distance(m_predicates.begin(), slot);
+    }
+
+    if (!changed)
+        return;
+
+    UiWatchdog::Activity activity("SortFilterProxyModel::filter");
+    clearPredicateMatches(changed);
+    invalidateFilter();
+    emit filtersChanged();
+}
+
+bool SortFilterProxyModel::acceptsPredicates(int sourceRow) const
+{
+    uint32_t active = 0;
+    for (size_t slot = 0; slot < m_predicates.size(); ++slot) {
+        if (!m_predicates[slot].role.isEmpty())
+            active |= 1u << slot;
+    }
+    if (!active)
+        return true;
+
+    if (sourceRow >= static_cast<int>(m_predicatesEvaluated.size())) {
+        const auto size = static_cast<size_t>(std::max(sourceRow + 1, sourceModel()->rowCount()));
+        m_predicatesEvaluated.resize(size, 0);
+        m_predicatesMatched.resize(size, 0);
+    }
+
+    auto& evaluated = m_predicatesEvaluated[sourceRow];
+    auto& matched = m_predicatesMatched[sourceRow];
+    const uint32_t pending = active & ~evaluated;
+    if (pending) {
+        const QModelIndex sourceIndex = sourceModel()->index(sourceRow, 0);
+        for (size_t slot = 0; slot < m_predicates.size(); ++slot) {
+            const uint32_t bit = 1u << slot;
+            if (!(pending & bit))
+                continue;
+            const auto& predicate = m_predicates[slot];
+            if (matchesValue(sourceModel()->data(sourceIndex, roleKey(predicate.role)), predicate.value))
+                matched |= bit;
+            else
+                matched &= ~bit;
+            evaluated |= bit;
+        }
+    }
+    return (matched & active) == active;
+}
+
 QVariantMap SortFilterProxyModel::get(int idx) const
 {
 	QVariantMap map;
@@ -109,16 +320,10 @@ QVariantMap SortFilterProxyModel::get(int idx) const
 
 QVariant SortFilterProxyModel::getRoleValue(int idx, QByteArray roleName) const
 {
-    QHash<int, QByteArray> roles = roleNames();
-    QHashIterator<int, QByteArray> it(roles);
-    while (it.hasNext()) {
-        it.next();
-        if (roleName == it.value())
-        {
-            return data(index(idx, 0), it.key());
-        }
-    }
-    return QVariant();
+    const int role = roleKey(roleName);
+    if (role < 0)
+        return QVariant();
+    return data(index(idx, 0), role);
 }
 
 void SortFilterProxyModel::classBegin()
@@ -128,22 +333,65 @@ void SortFilterProxyModel::classBegin()
 void SortFilterProxyModel::componentComplete()
 {
     m_complete = true;
-    if (!m_sortRole.isEmpty())
+    if (!m_sortRole.isEmpty()) {
+        clearSortKeys();
         QSortFilterProxyModel::setSortRole(roleKey(m_sortRole));
+    }
     if (!m_filterRole.isEmpty())
         QSortFilterProxyModel::setFilterRole(roleKey(m_filterRole));
 }
 
 int SortFilterProxyModel::roleKey(const QByteArray &role) const
 {
+    const auto cached = m_roleKeys.constFind(role);
+    if (cached != m_roleKeys.constEnd())
+        return cached.value();
+
+    int key = -1;
     QHash<int, QByteArray> roles = roleNames();
     QHashIterator<int, QByteArray> it(roles);
     while (it.hasNext()) {
         it.next();
-        if (it.value() == role)
-            return it.key();
+        if (it.value() == role) {
+            key = it.key();
+            break;
+        }
     }
-    return -1;
+    // unknown roles are not cached, source model can be set later
+    if (key >= 0)
+        m_roleKeys.insert(role, key);
+    return key;
+}
+
+bool SortFilterProxyModel::getSortKey(int row, int role, SortKey& key) const
+{
+    if (!m_sortKeyProvider)
+        return false;
+    const QModelIndex sourceIndex = mapToSource(index(row, 0));
+    return sourceIndex.isValid() && m_sortKeyProvider->getSortKey(sourceIndex.row(), role, key);
+}
+
+bool SortFilterProxyModel::fillSortKey(int sourceRow) const
+{
+    if (sourceRow >= static_cast<int>(m_sortKeys.size())) {
+        const auto size = static_cast<size_t>(std::max(sourceRow + 1, sourceModel()->rowCount()));
+        m_sortKeys.resize(size);
+        m_sortKeyValid.resize(size, 0);
+    }
+
+    if (m_sortKeyValid[sourceRow])
+        return true;
+    if (!m_sortKeyProvider->getSortKey(sourceRow, QSortFilterProxyModel::sortRole(), m_sortKeys[sourceRow]))
+        return false;
+    m_sortKeyValid[sourceRow] = 1;
+    return true;
+}
+
+bool SortFilterProxyModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
+{
+    if (m_sortKeyProvider && !left.parent().isValid() && fillSortKey(left.row()) && fillSortKey(right.row()))
+        return m_sortKeys[left.row()].lessThan(m_sortKeys[right.row()], sortCaseSensitivity());
+    return QSortFilterProxyModel::lessThan(left, right);
 }
 
 QHash<int, QByteArray> SortFilterProxyModel::roleNames() const
@@ -153,11 +401,55 @@ QHash<int, QByteArray> SortFilterProxyModel::roleNames() const
     return QHash<int, QByteArray>();
 }
 
+bool SortFilterProxyModel::canUseSearchIndex() const
+{
+    if (filterCaseSensitivity() != Qt::CaseInsensitive)
+        return false;
+
+    // only plain substring queries can be answered by the index
+    const QRegExp& rx = filterRegExp();
+    switch (rx.patternSyntax()) {
+    case QRegExp::FixedString:
+        return true;
+    case QRegExp::Wildcard:
+        for (const auto& c : rx.pattern()) {
+            if (c == '*' || c == '?' || c == '[' || c == ']')
+                return false;
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool SortFilterProxyModel::acceptsIndexedSearch(int sourceRow, bool& accepted) const
+{
+    const auto* provider = m_searchIndexProvider;
+    if (!provider || !provider->isSearchRole(roleKey(m_filterRole)) || !canUseSearchIndex())
+        return false;
+
+    const QString& query = filterRegExp().pattern();
+    if (!m_searchValid || m_searchQuery != query || m_searchRevision != provider->getSearchRevision()) {
+        m_searchMatches = provider->search(query);
+        m_searchQuery = query;
+        m_searchRevision = provider->getSearchRevision();
+        m_searchValid = true;
+    }
+
+    accepted = m_searchMatches && m_searchMatches->containsRow(sourceRow);
+    return true;
+}
+
 bool SortFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
+    if (!sourceParent.isValid() && !acceptsPredicates(sourceRow))
+        return false;
     QRegExp rx = filterRegExp();
     if (rx.isEmpty())
         return true;
+    bool accepted = false;
+    if (!sourceParent.isValid() && acceptsIndexedSearch(sourceRow, accepted))
+        return accepted;
     QAbstractItemModel *model = sourceModel();
     if (filterRole().isEmpty()) {
         QHash<int, QByteArray> roles = roleNames();
@@ -15,8 +15,14 @@
 
 #include <QtCore/qsortfilterproxymodel.h>
 #include <QtQml/qqmlparserstatus.h>
+#include <memory>
+#include <vector>
+#include "sort_key.h"
 
-class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStatus
+class SearchIndexProvider;
+class SearchMatches;
+
+class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStatus, public SortKeyProvider
 {
     Q_OBJECT
     Q_INTERFACES(QQmlParserStatus)
@@ -30,6 +36,9 @@ class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStat
     Q_PROPERTY(QByteArray filterRole READ filterRole WRITE setFilterRole)
     Q_PROPERTY(QString filterString READ filterString WRITE setFilterString)
     Q_PROPERTY(FilterSyntax filterSyntax READ filterSyntax WRITE setFilterSyntax)
+    // role name -> value, row is accepted when all of them match and filterString matches too.
+    // List values returned by the source role match if they contain the value.
+    Q_PROPERTY(QVariantMap filters READ filters WRITE setFilters NOTIFY filtersChanged)
 
     Q_ENUMS(FilterSyntax)
 
@@ -38,6 +47,7 @@ public:
 
     QObject *source() const;
     void setSource(QObject *source);
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
 
     QByteArray sortRole() const;
     void setSortRole(const QByteArray &role);
@@ -59,6 +69,9 @@ public:
     FilterSyntax filterSyntax() const;
     void setFilterSyntax(FilterSyntax syntax);
 
+    QVariantMap filters() const;
+    void setFilters(const QVariantMap& filters);
+
     int count() const;
     Q_INVOKABLE QVariantMap get(int index) const;
     Q_INVOKABLE QVariant getRoleValue(int index, QByteArray roleName) const;
@@ -66,16 +79,58 @@ public:
     void classBegin();
     void componentComplete();
 
+    // SortKeyProvider, forwards to the source model, so chained proxies keep typed sorting
+    bool getSortKey(int row, int role, SortKey& key) const override;
+
 signals:
     void countChanged();
+    void filtersChanged();
 
 protected:
     int roleKey(const QByteArray &role) const;
     QHash<int, QByteArray> roleNames() const;
     bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
+    bool lessThan(const QModelIndex &left, const QModelIndex &right) const override;
 
 private:
+    void connectSource(QAbstractItemModel *source);
+    void clearSortKeys();
+    void clearPredicateMatches(uint32_t slots);
+    bool acceptsPredicates(int sourceRow) const;
+    bool fillSortKey(int sourceRow) const;
+    bool acceptsIndexedSearch(int sourceRow, bool& accepted) const;
+    bool canUseSearchIndex() const;
+
     bool m_complete;
     QByteArray m_sortRole;
     QByteArray m_filterRole;
+    mutable QHash<QByteArray, int> m_roleKeys;
+
+    // source model interfaces, resolved once per source
+    const SortKeyProvider* m_sortKeyProvider = nullptr;
+    const SearchIndexProvider* m_searchIndexProvider = nullptr;
+    QList<QMetaObject::Connection> m_sourceConnections;
+
+    // Sort keys of the source rows, filled on first comparison and kept
+    // in sync with source changes, so inserted rows are placed without
+    // asking the source again for every comparison
+    mutable std::vector<SortKey> m_sortKeys;
+    mutable std::vector<char> m_sortKeyValid;
+
+    struct Predicate
+    {
+        QByteArray role;
+        QVariant value;
+    };
+    // slot of the predicate is a bit in the per row masks below, empty role marks free slot
+    std::vector<Predicate> m_predicates;
+    // per source row: predicates evaluated and predicates matched
+    mutable std::vector<uint32_t> m_predicatesEvaluated;
+    mutable std::vector<uint32_t> m_predicatesMatched;
+
+    // matches of the current filter string, see SearchIndexProvider
+    mutable std::shared_ptr<const SearchMatches> m_searchMatches;
+    mutable QString m_searchQuery;
+    mutable uint64_t m_searchRevision = 0;
+    mutable bool m_searchValid = false;
 };
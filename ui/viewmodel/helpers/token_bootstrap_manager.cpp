@@ -21,13 +21,7 @@
 TokenBootstrapManager::TokenBootstrapManager()
     : _wallet_model(*AppModel::getInstance().getWalletModel())
 {
-    connect(
-        &_wallet_model,
-        SIGNAL(transactionsChanged(beam::wallet::ChangeAction,
-                        const std::vector<beam::wallet::TxDescription>&)),
-        SLOT(onTransactionsChanged(beam::wallet::ChangeAction,
-                        const std::vector<beam::wallet::TxDescription>&)));
-    _wallet_model.getAsync()->getTransactions();
+    _wallet_model.getTxStore().subscribe(this, &TokenBootstrapManager::onTransactionsChanged);
 }
 
 TokenBootstrapManager::~TokenBootstrapManager() {}
@@ -91,9 +85,11 @@ void TokenBootstrapManager::checkTokenForDuplicate(const QString& token)
     auto txIdValue = txId.value();
     _tokensInProgress[txIdValue] = token;
 
-    _myTxIds.empty()
-        ? _wallet_model.getAsync()->getTransactions()
-        : checkIsTxPreviousAccepted();
+    // not loaded history is checked when it comes
+    if (_wallet_model.getTxStore().isLoaded())
+    {
+        checkIsTxPreviousAccepted();
+    }
 }
 
 void TokenBootstrapManager::checkIsTxPreviousAccepted()
@@ -14,34 +14,31 @@
 
 #include "exchange_rates_manager.h"
 
-#include "model/app_model.h"
+#include <QDateTime>
+
 #include "viewmodel/ui_helpers.h"
 #include "viewmodel/qml_globals.h"
-
-// test
 #include "utility/logger.h"
 
 using namespace beam::wallet;
 
-ExchangeRatesManager::ExchangeRatesManager()
-    : m_walletModel(*AppModel::getInstance().getWalletModel())
-    , m_settings(AppModel::getInstance().getSettings())
+ExchangeRatesManager::ExchangeRatesManager(WalletModel::Ptr wallet, WalletSettings& settings)
+    : m_walletModel(wallet)
+    , m_settings(settings)
+    , m_history(std::make_shared<RateHistory>(QString::fromStdString(settings.getWalletFolder() + "/" + WalletSettings::RateHistoryFile)))
 {
+    m_history->load();
 
     qRegisterMetaType<std::vector<beam::wallet::ExchangeRate>>("std::vector<beam::wallet::ExchangeRate>");
+    qRegisterMetaType<beam::wallet::ExchangeRate::Currency>("beam::wallet::ExchangeRate::Currency");
 
-    connect(&m_walletModel,
-            SIGNAL(exchangeRatesUpdate(const std::vector<beam::wallet::ExchangeRate>&)),
-            SLOT(onExchangeRatesUpdate(const std::vector<beam::wallet::ExchangeRate>&)));
-
-    connect(&m_settings,
-            SIGNAL(secondCurrencyChanged()),
-            SLOT(onRateUnitChanged()));
+    connect(m_walletModel.get(), &WalletModel::exchangeRatesUpdate, this, &ExchangeRatesManager::onExchangeRatesUpdate);
+    connect(&m_settings, &WalletSettings::secondCurrencyChanged, this, &ExchangeRatesManager::onRateUnitChanged);
 
     m_rateUnit = ExchangeRate::from_string(m_settings.getSecondCurrency().toStdString());
     if (m_rateUnit != ExchangeRate::Currency::Unknown)
     {
-        m_walletModel.getAsync()->getExchangeRates();
+        m_walletModel->getAsync()->getExchangeRates();
     }
 }
 
@@ -51,19 +48,25 @@ void ExchangeRatesManager::setRateUnit()
 
     if (newCurrency == ExchangeRate::Currency::Unknown && m_rateUnit != newCurrency)
     {
-        m_walletModel.getAsync()->switchOnOffExchangeRates(false);
+        m_walletModel->getAsync()->switchOnOffExchangeRates(false);
     }
     else
     {
         if (m_rateUnit == ExchangeRate::Currency::Unknown)
         {
-            m_walletModel.getAsync()->switchOnOffExchangeRates(true);
+            m_walletModel->getAsync()->switchOnOffExchangeRates(true);
         }
         if (m_rateUnit != newCurrency)
         {
-            m_walletModel.getAsync()->getExchangeRates();
+            m_walletModel->getAsync()->getExchangeRates();
         }
     }
+
+    if (m_rateUnit != newCurrency)
+    {
+        // rates of the previous unit are not valid anymore
+        m_rates.clear();
+    }
     m_rateUnit = newCurrency;
 }
 
@@ -71,21 +74,30 @@ void ExchangeRatesManager::onExchangeRatesUpdate(const std::vector<beam::wallet:
 {
     if (m_rateUnit == ExchangeRate::Currency::Unknown) return;  /// Second currency is turned OFF
 
-    bool isActiveRateChanged = false;
+    m_history->add(rates);
+
+    std::vector<ExchangeRate::Currency> changed;
     for (const auto& rate : rates)
     {
-        {
-            PrintableAmount amount(rate.m_rate, true /*show decimal point*/);
-            LOG_DEBUG() << "Exchange rate: 1 " << beam::wallet::ExchangeRate::to_string(rate.m_currency) << " = "
-                        << amount << " " << beam::wallet::ExchangeRate::to_string(rate.m_unit);
-        }
-
         if (rate.m_unit != m_rateUnit) continue;
-        m_rates[rate.m_currency] = rate.m_rate;
-        isActiveRateChanged = true;
+
+        auto& stored = m_rates[rate.m_currency];
+        if (stored == rate.m_rate) continue;
+        stored = rate.m_rate;
+        changed.push_back(rate.m_currency);
+
+        PrintableAmount amount(rate.m_rate, true /*show decimal point*/);
+        LOG_DEBUG() << "Exchange rate: 1 " << beam::wallet::ExchangeRate::to_string(rate.m_currency) << " = "
+                    << amount << " " << beam::wallet::ExchangeRate::to_string(rate.m_unit);
+    }
+
+    for (auto currency : changed)
+    {
+        emit rateChanged(currency);
     }
 
-    if (isActiveRateChanged) {
+    if (!changed.empty())
+    {
         emit activeRateChanged();
     }
 }
@@ -107,7 +119,18 @@ beam::wallet::ExchangeRate::Currency ExchangeRatesManager::getRateUnitRaw() cons
 beam::Amount ExchangeRatesManager::getRate(ExchangeRate::Currency currency) const
 {
     const auto it = m_rates.find(currency);
-    return (it == std::cend(m_rates)) ? 0 : it->second;
+    if (it != std::cend(m_rates))
+    {
+        return it->second;
+    }
+
+    // until the rates come, a stored one is shown only if it is recent enough
+    return m_history->getRate(currency, m_rateUnit, static_cast<beam::Timestamp>(QDateTime::currentSecsSinceEpoch()));
+}
+
+RateHistory::Ptr ExchangeRatesManager::getHistory() const
+{
+    return m_history;
 }
 
 ExchangeRate::Currency ExchangeRatesManager::convertCurrencyToExchangeCurrency(WalletCurrency::Currency uiCurrency)
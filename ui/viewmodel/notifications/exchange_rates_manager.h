@@ -17,18 +17,42 @@
 
 #include "model/wallet_model.h"
 #include "model/settings.h"
+#include "model/rate_history.h"
 #include "wallet/client/extensions/news_channels/interface.h"
 #include "viewmodel/currencies.h"   // WalletCurrency::Currency enum used in UI
 
+//
+// Application wide exchange rates, owned by AppModel. Rates are requested once and kept
+// in a single table for the rate unit selected in settings.
+//
 class ExchangeRatesManager : public QObject
 {
     Q_OBJECT
 public:
-    ExchangeRatesManager();
+    typedef std::shared_ptr<ExchangeRatesManager> Ptr;
 
+    ExchangeRatesManager(WalletModel::Ptr wallet, WalletSettings& settings);
+
+    // Current rate, the last stored one until rates are received
     beam::Amount getRate(beam::wallet::ExchangeRate::Currency) const;
+    // Rates received before, shared with transaction objects
+    RateHistory::Ptr getHistory() const;
     beam::wallet::ExchangeRate::Currency getRateUnitRaw() const;
 
+    // Calls @slot when the rate of @currency or the rate unit changes
+    template <typename Receiver>
+    void subscribe(beam::wallet::ExchangeRate::Currency currency, Receiver* receiver, void (Receiver::*slot)())
+    {
+        connect(this, &ExchangeRatesManager::rateUnitChanged, receiver, slot);
+        connect(this, &ExchangeRatesManager::rateChanged, receiver, [receiver, slot, currency] (beam::wallet::ExchangeRate::Currency changed)
+        {
+            if (changed == currency)
+            {
+                (receiver->*slot)();
+            }
+        });
+    }
+
     static beam::wallet::ExchangeRate::Currency convertCurrencyToExchangeCurrency(WalletCurrency::Currency uiCurrency);
 
 public slots:
@@ -37,14 +61,17 @@ public slots:
 
 signals:
     void rateUnitChanged();
+    // Any rate in the current unit has changed, emitted once per update
     void activeRateChanged();
+    void rateChanged(beam::wallet::ExchangeRate::Currency currency);
 
 private:
     void setRateUnit();
 
-    WalletModel& m_walletModel;
+    WalletModel::Ptr m_walletModel;
     WalletSettings& m_settings;
 
     beam::wallet::ExchangeRate::Currency m_rateUnit;
     std::map<beam::wallet::ExchangeRate::Currency, beam::Amount> m_rates;
+    RateHistory::Ptr m_history;
 };
@@ -18,7 +18,18 @@
 NotificationsList::NotificationsList()
 {
     _amgr = AppModel::getInstance().getAssets();
-    connect(_amgr.get(), &AssetsManager::assetInfo, this, &NotificationsList::onAssetInfo);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged, this, &NotificationsList::onAssetsInfo);
+}
+
+ECC::uintBig NotificationsList::getItemKey(const std::shared_ptr<NotificationItem>& item) const
+{
+    return item->getID();
+}
+
+bool NotificationsList::isItemChanged(const std::shared_ptr<NotificationItem>& stored, const std::shared_ptr<NotificationItem>& item) const
+{
+    // content of a notification is not changed, it is only read or deleted
+    return stored->getState() != item->getState() || stored->getTimestamp() != item->getTimestamp();
 }
 
 QHash<int, QByteArray> NotificationsList::roleNames() const
@@ -81,12 +92,12 @@ QVariant NotificationsList::data(const QModelIndex &index, int role) const
     }
 }
 
-void NotificationsList::onAssetInfo(beam::Asset::ID assetId)
+void NotificationsList::onAssetsInfo(const std::set<beam::Asset::ID>& assetIds)
 {
     for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->assetId() == assetId) {
+        if (assetIds.count((*it)->assetId())) {
            const auto idx = it - m_list.begin();
-           ListModel::touch(idx);
+           touch(idx);
         }
     }
 }
@@ -19,7 +19,7 @@
 #include "viewmodel/wallet/assets_manager.h"
 #include <QLocale>
 
-class NotificationsList : public ListModel<std::shared_ptr<NotificationItem>>
+class NotificationsList : public KeyedListModel<std::shared_ptr<NotificationItem>, ECC::uintBig>
 {
     Q_OBJECT
 
@@ -41,8 +41,12 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+protected:
+    ECC::uintBig getItemKey(const std::shared_ptr<NotificationItem>& item) const override;
+    bool isItemChanged(const std::shared_ptr<NotificationItem>& stored, const std::shared_ptr<NotificationItem>& item) const override;
+
 private:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const std::set<beam::Asset::ID>& assetIds);
 
     QLocale m_locale; // default locale
     AssetsManager::Ptr _amgr;
@@ -109,7 +109,7 @@ void NotificationsViewModel::onNotificationsDataModelChanged(ChangeAction action
     {
         case ChangeAction::Reset:
             {
-                m_notificationsList.reset(modifiedNotifications);
+                m_notificationsList.reconcile(modifiedNotifications);
                 break;
             }
 
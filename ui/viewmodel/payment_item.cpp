@@ -24,7 +24,7 @@ PaymentInfoItem::PaymentInfoItem(QObject* parent /* = nullptr */)
     : QObject(parent)
 {
     _amgr = AppModel::getInstance().getAssets();
-    connect(_amgr.get(), &AssetsManager::assetInfo, this, &PaymentInfoItem::onAssetInfo);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged, this, &PaymentInfoItem::onAssetsInfo);
 }
 
 QString PaymentInfoItem::getSender() const
@@ -47,13 +47,13 @@ QString PaymentInfoItem::getReceiver() const
     return "";
 }
 
-void PaymentInfoItem::onAssetInfo(beam::Asset::ID changedAssetId)
+void PaymentInfoItem::onAssetsInfo(const std::set<beam::Asset::ID>& assetIds)
 {
     beam::Asset::ID assetId = 0;
     if (m_paymentInfo) assetId = m_paymentInfo->m_AssetID;
     if (m_shieldedPaymentInfo) assetId = m_shieldedPaymentInfo->m_AssetID;
 
-    if (assetId == changedAssetId)
+    if (assetIds.count(assetId))
     {
         emit paymentProofChanged();
     }
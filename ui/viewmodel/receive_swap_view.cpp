@@ -68,6 +68,7 @@ ReceiveSwapViewModel::ReceiveSwapViewModel()
     , _offerExpires(OfferExpires12h)
     , _saveParamsAllowed(false)
     , _walletModel(*AppModel::getInstance().getWalletModel())
+    , _exchangeRatesManager(AppModel::getInstance().getRates())
     , _txParameters(beam::wallet::CreateSwapTransactionParameters())
     , _isBeamSide(false)
     , _minimalBeamFeeGrothes(minimalFee(Currency::CurrBeam, false))
@@ -77,8 +78,8 @@ ReceiveSwapViewModel::ReceiveSwapViewModel()
     connect(&_walletModel, &WalletModel::swapParamsLoaded, this, &ReceiveSwapViewModel::onSwapParamsLoaded);
     connect(&_walletModel, SIGNAL(newAddressFailed()), this, SIGNAL(newAddressFailed()));
     connect(&_walletModel, &WalletModel::walletStatusChanged, this, &ReceiveSwapViewModel::updateTransactionToken);
-    connect(&_exchangeRatesManager, &ExchangeRatesManager::rateUnitChanged, this, &ReceiveSwapViewModel::secondCurrencyUnitNameChanged);
-    connect(&_exchangeRatesManager, &ExchangeRatesManager::activeRateChanged, this, &ReceiveSwapViewModel::secondCurrencyRateChanged);
+    connect(_exchangeRatesManager.get(), &ExchangeRatesManager::rateUnitChanged, this, &ReceiveSwapViewModel::secondCurrencyUnitNameChanged);
+    connect(_exchangeRatesManager.get(), &ExchangeRatesManager::activeRateChanged, this, &ReceiveSwapViewModel::secondCurrencyRateChanged);
     connect(&_walletModel, &WalletModel::shieldedCoinsSelectionCalculated, this, &ReceiveSwapViewModel::onShieldedCoinsSelectionCalculated);
 
     generateNewAddress();
@@ -519,14 +520,14 @@ void ReceiveSwapViewModel::updateTransactionToken()
 QString ReceiveSwapViewModel::getSecondCurrencySendRateValue() const
 {
     auto sendCurrency = ExchangeRatesManager::convertCurrencyToExchangeCurrency(getSentCurrency());
-    auto rate = _exchangeRatesManager.getRate(sendCurrency);
+    auto rate = _exchangeRatesManager->getRate(sendCurrency);
     return beamui::AmountToUIString(rate);
 }
 
 QString ReceiveSwapViewModel::getSecondCurrencyReceiveRateValue() const
 {
     auto receiveCurrency = ExchangeRatesManager::convertCurrencyToExchangeCurrency(getReceiveCurrency());
-    auto rate = _exchangeRatesManager.getRate(receiveCurrency);
+    auto rate = _exchangeRatesManager->getRate(receiveCurrency);
     return beamui::AmountToUIString(rate);
 }
 
@@ -537,5 +538,5 @@ unsigned int ReceiveSwapViewModel::getMinimalBeamFeeGrothes() const
 
 QString ReceiveSwapViewModel::getSecondCurrencyUnitName() const
 {
-    return beamui::getCurrencyUnitName(_exchangeRatesManager.getRateUnitRaw());
+    return beamui::getCurrencyUnitName(_exchangeRatesManager->getRateUnitRaw());
 }
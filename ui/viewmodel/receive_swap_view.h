@@ -141,7 +141,7 @@ private:
 
     beam::wallet::WalletAddress _receiverAddress;
     WalletModel& _walletModel;
-    ExchangeRatesManager _exchangeRatesManager;
+    ExchangeRatesManager::Ptr _exchangeRatesManager;
     beam::wallet::TxParameters _txParameters;
     bool _isBeamSide;
 
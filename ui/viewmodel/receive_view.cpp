@@ -29,10 +29,10 @@ ReceiveViewModel::ReceiveViewModel()
     : _amountToReceiveGrothes(0)
     , _addressExpires(AddressExpires)
     , _walletModel(*AppModel::getInstance().getWalletModel())
+    , _exchangeRatesManager(AppModel::getInstance().getRates())
 {
     connect(&_walletModel, &WalletModel::newAddressFailed, this, &ReceiveViewModel::newAddressFailed);
-    connect(&_exchangeRatesManager, &ExchangeRatesManager::rateUnitChanged, this, &ReceiveViewModel::rateChanged);
-    connect(&_exchangeRatesManager, &ExchangeRatesManager::activeRateChanged, this, &ReceiveViewModel::rateChanged);
+    _exchangeRatesManager->subscribe(beam::wallet::ExchangeRate::Currency::Beam, this, &ReceiveViewModel::rateChanged);
     updateTransactionToken();
 }
 
@@ -236,12 +236,12 @@ void ReceiveViewModel::updateTransactionToken()
 
 QString ReceiveViewModel::getRateUnit() const
 {
-    return beamui::getCurrencyUnitName(_exchangeRatesManager.getRateUnitRaw());
+    return beamui::getCurrencyUnitName(_exchangeRatesManager->getRateUnitRaw());
 }
 
 QString ReceiveViewModel::getRate() const
 {
-    auto rate = _exchangeRatesManager.getRate(beam::wallet::ExchangeRate::Currency::Beam);
+    auto rate = _exchangeRatesManager->getRate(beam::wallet::ExchangeRate::Currency::Beam);
     return beamui::AmountToUIString(rate);
 }
 
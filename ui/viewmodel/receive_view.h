@@ -109,5 +109,5 @@ private:
     bool _isShieldedTx = false;
     bool _isPermanentAddress = false;
     WalletModel& _walletModel;
-    ExchangeRatesManager _exchangeRatesManager;
+    ExchangeRatesManager::Ptr _exchangeRatesManager;
 };
@@ -31,14 +31,15 @@ SendSwapViewModel::SendSwapViewModel()
     , _receiveCurrency(Currency::CurrStart)
     , _changeGrothes(0)
     , _walletModel(*AppModel::getInstance().getWalletModel())
+    , _exchangeRatesManager(AppModel::getInstance().getRates())
     , _isBeamSide(true)
     , _minimalBeamFeeGrothes(minimalFee(Currency::CurrBeam, false))
     , _shieldedInputsFee(0)
 {
     connect(&_walletModel, &WalletModel::changeCalculated,  this,  &SendSwapViewModel::onChangeCalculated);
     connect(&_walletModel, &WalletModel::walletStatusChanged, this, &SendSwapViewModel::recalcAvailable);
-    connect(&_exchangeRatesManager, SIGNAL(rateUnitChanged()), SIGNAL(secondCurrencyUnitNameChanged()));
-    connect(&_exchangeRatesManager, SIGNAL(activeRateChanged()), SIGNAL(secondCurrencyRateChanged()));
+    connect(_exchangeRatesManager.get(), SIGNAL(rateUnitChanged()), SIGNAL(secondCurrencyUnitNameChanged()));
+    connect(_exchangeRatesManager.get(), SIGNAL(activeRateChanged()), SIGNAL(secondCurrencyRateChanged()));
     connect(&_walletModel, &WalletModel::shieldedCoinsSelectionCalculated, this, &SendSwapViewModel::onShieldedCoinsSelectionCalculated);
 }
 
@@ -462,20 +463,20 @@ QString SendSwapViewModel::getRate() const
 QString SendSwapViewModel::getSecondCurrencySendRateValue() const
 {
     auto sendCurrency = ExchangeRatesManager::convertCurrencyToExchangeCurrency(getSendCurrency());
-    auto rate = _exchangeRatesManager.getRate(sendCurrency);
+    auto rate = _exchangeRatesManager->getRate(sendCurrency);
     return beamui::AmountToUIString(rate);
 }
 
 QString SendSwapViewModel::getSecondCurrencyReceiveRateValue() const
 {
     auto receiveCurrency = ExchangeRatesManager::convertCurrencyToExchangeCurrency(getReceiveCurrency());
-    auto rate = _exchangeRatesManager.getRate(receiveCurrency);
+    auto rate = _exchangeRatesManager->getRate(receiveCurrency);
     return beamui::AmountToUIString(rate);
 }
 
 QString SendSwapViewModel::getSecondCurrencyUnitName() const
 {
-    return beamui::getCurrencyUnitName(_exchangeRatesManager.getRateUnitRaw());
+    return beamui::getCurrencyUnitName(_exchangeRatesManager->getRateUnitRaw());
 }
 
 bool SendSwapViewModel::isTokenGeneratedByNewVersion() const
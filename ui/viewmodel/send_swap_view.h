@@ -150,7 +150,7 @@ private:
     QString      _token;
 
     WalletModel& _walletModel;
-    ExchangeRatesManager _exchangeRatesManager;
+    ExchangeRatesManager::Ptr _exchangeRatesManager;
     beam::wallet::TxParameters _txParameters;
     bool _isBeamSide;
 
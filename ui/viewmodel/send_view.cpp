@@ -47,18 +47,17 @@ namespace
 SendViewModel::SendViewModel()
     : _fee(minimalFee(Currency::CurrBeam, false))
     , _walletModel(*AppModel::getInstance().getWalletModel())
+    , _exchangeRatesManager(AppModel::getInstance().getRates())
     , _amgr(AppModel::getInstance().getAssets())
     , _minFee(minFeeBeam(false))
 {
     connect(&_walletModel,           SIGNAL(sendMoneyVerified()),               this,  SIGNAL(sendMoneyVerified()));
     connect(&_walletModel,           SIGNAL(cantSendToExpired()),               this,  SIGNAL(cantSendToExpired()));
     connect(&_walletModel,           &WalletModel::walletStatusChanged,              this,  &SendViewModel::availableChanged);
-    connect(&_exchangeRatesManager,  &ExchangeRatesManager::rateUnitChanged,         this,  &SendViewModel::assetsListChanged);
-    connect(&_exchangeRatesManager,  &ExchangeRatesManager::activeRateChanged,       this,  &SendViewModel::assetsListChanged);
-    connect(&_exchangeRatesManager,  &ExchangeRatesManager::rateUnitChanged,         this,  &SendViewModel::feeRateChanged);
-    connect(&_exchangeRatesManager,  &ExchangeRatesManager::activeRateChanged,       this,  &SendViewModel::feeRateChanged);
+    _exchangeRatesManager->subscribe(beam::wallet::ExchangeRate::Currency::Beam, this, &SendViewModel::assetsListChanged);
+    _exchangeRatesManager->subscribe(beam::wallet::ExchangeRate::Currency::Beam, this, &SendViewModel::feeRateChanged);
     connect(&_walletModel,           &WalletModel::shieldedCoinsSelectionCalculated, this,  &SendViewModel::onSelectionCalculated);
-    connect(_amgr.get(),             &AssetsManager::assetInfo,                      this,  &SendViewModel::onAssetInfo);
+    connect(_amgr.get(),             &AssetsManager::assetsInfoChanged,              this,  &SendViewModel::onAssetsInfo);
 }
 
 unsigned int SendViewModel::getFeeGrothes() const
@@ -654,12 +653,12 @@ Your version is: %2. Please, check for updates."
 
 QString SendViewModel::getFeeRateUnit() const
 {
-    return beamui::getCurrencyUnitName(_exchangeRatesManager.getRateUnitRaw());
+    return beamui::getCurrencyUnitName(_exchangeRatesManager->getRateUnitRaw());
 }
 
 QString SendViewModel::getFeeRate() const
 {
-    auto rate = _exchangeRatesManager.getRate(beam::wallet::ExchangeRate::Currency::Beam);
+    auto rate = _exchangeRatesManager->getRate(beam::wallet::ExchangeRate::Currency::Beam);
     return beamui::AmountToUIString(rate);
 }
 
@@ -702,7 +701,7 @@ QString SendViewModel::getMaxSendAmount() const
     return beamui::AmountToUIString(_maxWhatCanSelect);
 }
 
-void SendViewModel::onAssetInfo(beam::Asset::ID assetId)
+void SendViewModel::onAssetsInfo(const std::set<beam::Asset::ID>& assetIds)
 {
     emit assetsListChanged();
 }
@@ -748,8 +747,8 @@ void SendViewModel::resetAddress()
 QList<QMap<QString, QVariant>> SendViewModel::getAssetsList() const
 {
     const auto assets   = _walletModel.getAssetsNZ();
-    const auto beamRate = beamui::AmountToUIString(_exchangeRatesManager.getRate(beam::wallet::ExchangeRate::Currency::Beam));
-    const auto rateUnit = beamui::getCurrencyUnitName(_exchangeRatesManager.getRateUnitRaw());
+    const auto beamRate = beamui::AmountToUIString(_exchangeRatesManager->getRate(beam::wallet::ExchangeRate::Currency::Beam));
+    const auto rateUnit = beamui::getCurrencyUnitName(_exchangeRatesManager->getRateUnitRaw());
     QList<QMap<QString, QVariant>> result;
 
     for(auto assetId: assets)
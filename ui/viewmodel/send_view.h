@@ -165,7 +165,7 @@ signals:
 
 public slots:
     void onSelectionCalculated(const beam::wallet::ShieldedCoinsSelectionInfo& selectionRes);
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const std::set<beam::Asset::ID>& assetIds);
 
 private:
     void onGetAddressReturned(const boost::optional<beam::wallet::WalletAddress>& address, int offlinePayments);
@@ -196,7 +196,7 @@ private:
     int _offlinePayments = 0;
 
     WalletModel&               _walletModel;
-    ExchangeRatesManager       _exchangeRatesManager;
+    ExchangeRatesManager::Ptr  _exchangeRatesManager;
     beam::wallet::TxParameters _txParameters;
     QString                    _newTokenMsg;
     AssetsManager::Ptr         _amgr;
@@ -5,6 +5,7 @@
 #include "3rdparty/libbitcoin/include/bitcoin/bitcoin/formats/base_10.hpp"
 #include "version.h"
 #include "core/common.h"
+#include "model/helpers.h"
 
 using namespace std;
 using namespace beam;
@@ -13,12 +14,7 @@ namespace beamui
 {
     QString toString(const beam::wallet::WalletID& walletID)
     {
-        if (walletID != Zero)
-        {
-            auto id = std::to_string(walletID);
-            return QString::fromStdString(id);
-        }
-        return "";
+        return walletID2qstr(walletID);
     }
 
     QString toString(const beam::wallet::PeerID& peerID)
@@ -18,6 +18,21 @@ UtxoItemList::UtxoItemList()
 {
 }
 
+uint64_t UtxoItemList::getItemKey(const std::shared_ptr<BaseUtxoItem>& item) const
+{
+    return item->getHash();
+}
+
+bool UtxoItemList::isItemChanged(const std::shared_ptr<BaseUtxoItem>& stored, const std::shared_ptr<BaseUtxoItem>& item) const
+{
+    return stored->status() != item->status()
+        || stored->rawAmount() != item->rawAmount()
+        || stored->maturity() != item->maturity()
+        || stored->rawMaturity() != item->rawMaturity()
+        || stored->maturityPercentage() != item->maturityPercentage()
+        || stored->rawMaturityTimeLeft() != item->rawMaturityTimeLeft();
+}
+
 QHash<int, QByteArray> UtxoItemList::roleNames() const
 {
     static const auto roles = QHash<int, QByteArray>
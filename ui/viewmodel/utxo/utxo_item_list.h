@@ -17,7 +17,7 @@
 #include "utxo_item.h"
 #include "viewmodel/helpers/list_model.h"
 
-class UtxoItemList : public ListModel<std::shared_ptr<BaseUtxoItem>>
+class UtxoItemList : public KeyedListModel<std::shared_ptr<BaseUtxoItem>, uint64_t>
 {
 
     Q_OBJECT
@@ -43,4 +43,8 @@ public:
 
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
+
+protected:
+    uint64_t getItemKey(const std::shared_ptr<BaseUtxoItem>& item) const override;
+    bool isItemChanged(const std::shared_ptr<BaseUtxoItem>& stored, const std::shared_ptr<BaseUtxoItem>& item) const override;
 };
@@ -28,7 +28,7 @@ UtxoViewModel::UtxoViewModel()
     connect(&m_model, SIGNAL(shieldedCoinChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::ShieldedCoin>&)),
         SLOT(onShieldedCoinChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::ShieldedCoin>&)));
 
-    connect(&m_model, &WalletModel::walletStatusChanged, this, &UtxoViewModel::stateChanged);
+    connect(&m_model, &WalletModel::stateIDChanged, this, &UtxoViewModel::stateChanged);
     connect(&m_model, SIGNAL(shieldedTotalCountChanged()), SLOT(onTotalShieldedCountChanged()));
 
     m_totalShieldedCount = m_model.getTotalShieldedCount();
@@ -83,7 +83,11 @@ void UtxoViewModel::onAllUtxoChanged(beam::wallet::ChangeAction action, const st
     {
     case ChangeAction::Reset:
     {
-        m_allUtxos.reset(modifiedItems);
+        // shielded coins come with their own reset
+        m_allUtxos.reconcile(modifiedItems, [](const auto& item)
+        {
+            return item->type() != UtxoViewType::EnType::Shielded;
+        });
         break;
     }
 
@@ -137,17 +141,10 @@ void UtxoViewModel::onShieldedCoinChanged(beam::wallet::ChangeAction action, con
     {
     case ChangeAction::Reset:
     {
-        // temporal hack
-        vector<shared_ptr<BaseUtxoItem>> toRemove;
-        for (const auto& item : m_allUtxos)
+        m_allUtxos.reconcile(modifiedItems, [](const auto& item)
         {
-            if (item->type() == UtxoViewType::EnType::Shielded)
-            {
-                toRemove.push_back(item);
-            }
-        }
-        m_allUtxos.remove(toRemove);
-        m_allUtxos.insert(modifiedItems);
+            return item->type() == UtxoViewType::EnType::Shielded;
+        });
         break;
     }
 
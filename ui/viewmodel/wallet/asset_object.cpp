@@ -16,8 +16,6 @@
 
 AssetObject::AssetObject(uint64_t id)
    : _id(id)
-   , _inTxCnt(0)
-   , _outTxCnt(0)
 {
 }
 
@@ -30,29 +28,3 @@ uint64_t AssetObject::id() const
 {
     return _id;
 }
-
-uint32_t AssetObject::inTxCnt() const
-{
-    return _inTxCnt;
-}
-
-uint32_t AssetObject::outTxCnt() const
-{
-    return _outTxCnt;
-}
-
-void AssetObject::resetTxCnt()
-{
-    _inTxCnt = 0;
-    _outTxCnt = 0;
-}
-
-void AssetObject::addIntTx()
-{
-    _inTxCnt++;
-}
-
-void AssetObject::addOutTx()
-{
-    _outTxCnt++;
-}
\ No newline at end of file
@@ -13,16 +13,14 @@
 
 AssetsList::AssetsList()
     : _amgr(AppModel::getInstance().getAssets())
+    , _ermgr(AppModel::getInstance().getRates())
     , _wallet(*AppModel::getInstance().getWalletModel())
 {
-    connect(&_ermgr,     &ExchangeRatesManager::rateUnitChanged,   this,  &AssetsList::onNewRates);
-    connect(&_ermgr,     &ExchangeRatesManager::activeRateChanged, this,  &AssetsList::onNewRates);
-    connect(&_wallet,    &WalletModel::walletStatusChanged,        this,  &AssetsList::onWalletStatus);
-    connect(&_wallet,    &WalletModel::transactionsChanged,        this,  &AssetsList::onTransactionsChanged);
-    connect(_amgr.get(), &AssetsManager::assetInfo,                this,  &AssetsList::onAssetInfo);
-
-    // Transactions table would be created later and get this for us
-    //_wallet.getAsync()->getTransactions();
+    _ermgr->subscribe(beam::wallet::ExchangeRate::Currency::Beam, this, &AssetsList::onNewRates);
+    connect(&_wallet,    &WalletModel::assetTotalsChanged,         this,  &AssetsList::onAssetTotalsChanged);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged,        this,  &AssetsList::onAssetsInfo);
+
+    _wallet.getTxStore().subscribe(this, &AssetsList::onTransactionsChanged);
 }
 
 QHash<int, QByteArray> AssetsList::roleNames() const
@@ -80,9 +78,9 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
         case Roles::RAmount:
             return beamui::AmountBigToUIString(_wallet.getAvailable(assetId));
         case Roles::RInTxCnt:
-            return static_cast<qint32>(asset->inTxCnt());
+            return static_cast<qint32>(getTxCounters(assetId).in);
         case Roles::ROutTxCnt:
-            return static_cast<qint32>(asset->outTxCnt());
+            return static_cast<qint32>(getTxCounters(assetId).out);
         case Roles::Search:
             return _amgr->getName(assetId) + _amgr->getUnitName(assetId, false);
         case Roles::RIcon:
@@ -92,12 +90,12 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
         case Roles::RSelectionColor:
             return _amgr->getSelectionColor(assetId);
         case Roles::RRateUnit:
-            return assetId < 1 ? beamui::getCurrencyUnitName(_ermgr.getRateUnitRaw()) : "";
+            return assetId < 1 ? beamui::getCurrencyUnitName(_ermgr->getRateUnitRaw()) : "";
         case Roles::RRate:
             {
                 if (assetId < 1)
                 {
-                    auto rate = _ermgr.getRate(beam::wallet::ExchangeRate::Currency::Beam);
+                    auto rate = _ermgr->getRate(beam::wallet::ExchangeRate::Currency::Beam);
                     return beamui::AmountToUIString(rate);
                 }
                 return "";
@@ -108,18 +106,6 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
     }
 }
 
-std::shared_ptr<AssetObject> AssetsList::get(beam::Asset::ID id)
-{
-     for (auto obj: m_list)
-     {
-         if (obj->id() == id)
-         {
-             return obj;
-         }
-     }
-     return std::shared_ptr<AssetObject>();
-}
-
 void AssetsList::touch(beam::Asset::ID id)
 {
     for (auto it = m_list.begin(); it != m_list.end(); ++it) {
@@ -135,61 +121,55 @@ void AssetsList::onNewRates()
     touch(beam::Asset::s_BeamID);
 }
 
-void AssetsList::onWalletStatus()
-{
-    for(const auto& asset: m_list)
-    {
-        touch(asset->id());
-    }
-}
-
-void AssetsList::onAssetInfo(beam::Asset::ID assetId)
+void AssetsList::onAssetTotalsChanged(beam::Asset::ID assetId)
 {
     touch(assetId);
 }
 
-void AssetsList::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+void AssetsList::onAssetsInfo(const std::set<beam::Asset::ID>& assetIds)
 {
-    using namespace beam::wallet;
-
-    TxList modified;
-
-    for (const auto& tx : items)
+    for (auto it = m_list.begin(); it != m_list.end(); ++it)
     {
-        if(const auto txType = tx.GetParameter<TxType>(TxParameterID::TransactionType))
+        if (assetIds.count((*it)->id()))
         {
-            if (txType == TxType::Simple || txType == TxType::PushTransaction)
-            {
-                modified.push_back(tx);
-            }
+            ListModel::touch(it - m_list.begin());
         }
     }
+}
+
+void AssetsList::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& items)
+{
+    using namespace beam::wallet;
+
+    std::set<beam::Asset::ID> changed;
 
     switch(action)
     {
     case ChangeAction::Reset:
-        _txlist.swap(modified);
+        for (const auto& p: _txCounters)
+        {
+            changed.insert(p.first);
+        }
+        _txIndex.clear();
+        _txCounters.clear();
+        for (const auto& tx : items)
+        {
+            setTx(*tx, changed);
+        }
         break;
 
     case ChangeAction::Removed:
-        for(auto del: modified)
+        for (const auto& tx : items)
         {
-            _txlist.erase(std::remove_if(_txlist.begin(), _txlist.end(), [&del](const TxDescription& t) {
-                return t.m_txId == del.m_txId;
-            }), _txlist.end());
+            removeTx(tx->txId, changed);
         }
         break;
 
     case ChangeAction::Added:
-        _txlist.insert(std::end(_txlist), std::begin(modified), std::end(modified));
-        break;
-
     case ChangeAction::Updated:
-        for(auto repl: modified)
+        for (const auto& tx : items)
         {
-            std::replace_if(_txlist.begin(), _txlist.end(), [&repl](const TxDescription& t) {
-                return t.m_txId == repl.m_txId;
-            }, repl);
+            setTx(*tx, changed);
         }
         break;
 
@@ -198,30 +178,77 @@ void AssetsList::onTransactionsChanged(beam::wallet::ChangeAction action, const
         break;
     }
 
-    for(auto& obj: m_list) {
-        obj->resetTxCnt();
+    for (auto id: changed)
+    {
+        touch(id);
     }
+}
 
-    for(const auto& tx: _txlist) {
-        if (auto obj = get(tx.m_assetId))
-        {
-            if(tx.m_status == wallet::TxStatus::Pending ||
-               tx.m_status == wallet::TxStatus::InProgress ||
-               tx.m_status == wallet::TxStatus::Registering)
-            {
-                if (tx.m_sender)
-                {
-                    obj->addOutTx();
-                }
-                else
-                {
-                    obj->addIntTx();
-                }
-            }
-        }
+void AssetsList::setTx(const TxRow& tx, std::set<beam::Asset::ID>& changed)
+{
+    using namespace beam::wallet;
+
+    // type is decoded with the row on the reactor thread
+    if (tx.txType != TxType::Simple && tx.txType != TxType::PushTransaction)
+    {
+        return;
     }
 
-     for(auto& obj: m_list) {
-         touch(obj->id());
-     }
+    TxInfo info;
+    info.assetId = tx.assetId;
+    info.sender  = tx.sender;
+    info.pending = tx.status == TxStatus::Pending ||
+                   tx.status == TxStatus::InProgress ||
+                   tx.status == TxStatus::Registering;
+
+    auto it = _txIndex.find(tx.txId);
+    if (it == _txIndex.end())
+    {
+        _txIndex.emplace(tx.txId, info);
+        countTx(info, 1, changed);
+        return;
+    }
+
+    auto& prev = it->second;
+    if (prev.assetId != info.assetId || prev.sender != info.sender || prev.pending != info.pending)
+    {
+        countTx(prev, -1, changed);
+        countTx(info, 1, changed);
+        prev = info;
+    }
+}
+
+void AssetsList::removeTx(const beam::wallet::TxID& txId, std::set<beam::Asset::ID>& changed)
+{
+    auto it = _txIndex.find(txId);
+    if (it != _txIndex.end())
+    {
+        countTx(it->second, -1, changed);
+        _txIndex.erase(it);
+    }
+}
+
+void AssetsList::countTx(const TxInfo& info, int delta, std::set<beam::Asset::ID>& changed)
+{
+    if (!info.pending)
+    {
+        return;
+    }
+
+    auto& counters = _txCounters[info.assetId];
+    auto& counter = info.sender ? counters.out : counters.in;
+    assert(delta > 0 || counter > 0);
+    counter += delta;
+    changed.insert(info.assetId);
+
+    if (!counters.in && !counters.out)
+    {
+        _txCounters.erase(info.assetId);
+    }
+}
+
+AssetsList::TxCounters AssetsList::getTxCounters(beam::Asset::ID id) const
+{
+    auto it = _txCounters.find(id);
+    return it != _txCounters.end() ? it->second : TxCounters();
 }
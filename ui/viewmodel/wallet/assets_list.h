@@ -12,6 +12,7 @@
 
 #include <memory>
 #include "asset_object.h"
+#include "model/tx_row.h"
 #include "viewmodel/helpers/list_model.h"
 #include "assets_manager.h"
 #include "viewmodel/notifications/exchange_rates_manager.h"
@@ -46,18 +47,35 @@ public:
 
 private slots:
     void onNewRates();
-    void onWalletStatus();
-    void onAssetInfo(beam::Asset::ID assetId);
-    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+    void onAssetTotalsChanged(beam::Asset::ID assetId);
+    void onAssetsInfo(const std::set<beam::Asset::ID>& assetIds);
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& items);
 
 private:
+    struct TxInfo
+    {
+        beam::Asset::ID assetId;
+        bool sender;
+        bool pending;
+    };
+
+    struct TxCounters
+    {
+        uint32_t in = 0;
+        uint32_t out = 0;
+    };
+
     void touch(beam::Asset::ID id);
-    std::shared_ptr<AssetObject> get(beam::Asset::ID id);
+    void setTx(const TxRow& tx, std::set<beam::Asset::ID>& changed);
+    void removeTx(const beam::wallet::TxID& txId, std::set<beam::Asset::ID>& changed);
+    void countTx(const TxInfo& info, int delta, std::set<beam::Asset::ID>& changed);
+    TxCounters getTxCounters(beam::Asset::ID id) const;
 
     AssetsManager::Ptr _amgr;
-    mutable ExchangeRatesManager _ermgr;
+    ExchangeRatesManager::Ptr _ermgr;
     WalletModel& _wallet;
 
-    typedef std::vector<beam::wallet::TxDescription> TxList;
-    TxList _txlist;
+    // simple and push transactions, pending ones are counted per asset
+    std::map<beam::wallet::TxID, TxInfo> _txIndex;
+    std::map<beam::Asset::ID, TxCounters> _txCounters;
 };
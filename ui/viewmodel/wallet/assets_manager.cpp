@@ -12,13 +12,39 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "assets_manager.h"
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include "utility/logger.h"
 
-AssetsManager::AssetsManager (WalletModel::Ptr wallet)
+namespace
+{
+    const quint32 kCacheVersion = 1;
+    // answers come in bursts on start, write them at once
+    const int kSaveCacheDelayMs = 1000;
+    // longest wait for the rest of a batch before showing answers already received
+    const int kNotifyDelayMs = 50;
+}
+
+AssetsManager::AssetsManager (WalletModel::Ptr wallet, const QString& cachePath)
     : _wallet(wallet)
+    , _cachePath(cachePath)
 {
     qRegisterMetaType<beam::Asset::ID>("beam::wallet::AssetID");
     connect(_wallet.get(), &WalletModel::assetInfoChanged, this, &AssetsManager::onAssetInfo);
 
+    _saveCacheTimer.setSingleShot(true);
+    _saveCacheTimer.setInterval(kSaveCacheDelayMs);
+    connect(&_saveCacheTimer, &QTimer::timeout, this, &AssetsManager::saveCache);
+
+    _requestTimer.setSingleShot(true);
+    _requestTimer.setInterval(0);
+    connect(&_requestTimer, &QTimer::timeout, this, &AssetsManager::sendRequests);
+
+    _notifyTimer.setSingleShot(true);
+    _notifyTimer.setInterval(kNotifyDelayMs);
+    connect(&_notifyTimer, &QTimer::timeout, this, &AssetsManager::flushChanged);
+
     _icons[0]  = "qrc:/assets/asset-0.svg";
     _icons[1]  = "qrc:/assets/asset-1.svg";
     _icons[2]  = "qrc:/assets/asset-2.svg";
@@ -28,25 +54,89 @@ AssetsManager::AssetsManager (WalletModel::Ptr wallet)
     _colors[1] = QColor(216, 133, 255, 252);
     _colors[2] = QColor(255, 231, 90, 252);
     _colors[3] = QColor(79, 165, 255, 252);
+
+    _beam.unitName = _beam.shortUnitName = "BEAM";
+    _beam.name  = "Beam";
+    _beam.icon  = "qrc:/assets/icon-beam.svg";
+    _beam.color = QColor(0, 246, 210, 252);
+
+    loadCache();
+    QTimer::singleShot(0, this, [this] ()
+    {
+        for (const auto& p: _assets)
+        {
+            collectAssetInfo(p.first);
+        }
+    });
+}
+
+AssetsManager::~AssetsManager()
+{
+    if (_saveCacheTimer.isActive())
+    {
+        saveCache();
+    }
 }
 
 void AssetsManager::collectAssetInfo(beam::Asset::ID assetId)
 {
     if (assetId < 1)
     {
-        emit assetInfo(assetId);
+        notifyChanged(assetId);
     }
     else
     {
         // don't request info multiple times
-        if (_requested.find(assetId) == _requested.end())
+        if (_requested.find(assetId) == _requested.end() && _pending.insert(assetId).second)
         {
-            _requested.insert(assetId);
-            _wallet->getAsync()->getAssetInfo(assetId);
+            _requestTimer.start();
         }
     }
 }
 
+void AssetsManager::sendRequests()
+{
+    // wallet API answers one asset per call, the whole batch is posted at once
+    for (auto assetId: _pending)
+    {
+        _requested.insert(assetId);
+        _wallet->getAsync()->getAssetInfo(assetId);
+    }
+    _pending.clear();
+}
+
+void AssetsManager::notifyChanged(beam::Asset::ID assetId)
+{
+    _changed.insert(assetId);
+    scheduleFlush();
+}
+
+void AssetsManager::scheduleFlush()
+{
+    if (_requested.empty())
+    {
+        // the batch is complete
+        _notifyTimer.stop();
+        flushChanged();
+    }
+    else if (!_changed.empty() && !_notifyTimer.isActive())
+    {
+        _notifyTimer.start();
+    }
+}
+
+void AssetsManager::flushChanged()
+{
+    if (_changed.empty())
+    {
+        return;
+    }
+
+    std::set<beam::Asset::ID> changed;
+    changed.swap(_changed);
+    emit assetsInfoChanged(changed);
+}
+
 void AssetsManager::onAssetInfo(beam::Asset::ID id, const beam::wallet::WalletAsset& info)
 {
     _requested.erase(id);
@@ -54,119 +144,161 @@ void AssetsManager::onAssetInfo(beam::Asset::ID id, const beam::wallet::WalletAs
     if (info.m_ID == beam::Asset::s_InvalidID)
     {
         // Bad info, erase any previously stored and if we had something stored notify about change
-        const auto it = _info.find(id);
-        if (it != _info.end())
+        if (_assets.erase(id))
         {
-            _info.erase(it);
-            emit assetInfo(id);
+            _saveCacheTimer.start();
+            _changed.insert(id);
         }
     }
     else
     {
         // Good info came, save and notify about change
-        _info[id] = info;
-        emit assetInfo(id);
+        beam::wallet::WalletAssetMeta meta(info);
+        const auto unitName = QString::fromStdString(meta.GetUnitName());
+        const auto name = QString::fromStdString(meta.GetName());
+
+        // nothing to notify if it is already shown from the cache
+        const auto it = _assets.find(id);
+        if (it == _assets.end() || it->second.metaUnitName != unitName || it->second.metaName != name || it->second.lockHeight != info.m_LockHeight)
+        {
+            _assets[id] = makeInfo(id, unitName, name, info.m_LockHeight);
+            _unknown.erase(id);
+            _saveCacheTimer.start();
+            _changed.insert(id);
+        }
     }
+
+    scheduleFlush();
 }
 
-AssetsManager::MetaPtr AssetsManager::getAsset(beam::Asset::ID id)
- {
-    const auto it = _info.find(id);
-    if (it != _info.end())
+const AssetsManager::AssetInfo& AssetsManager::getInfo(beam::Asset::ID id)
+{
+    if (id < 1)
+    {
+        return _beam;
+    }
+
+    const auto it = _assets.find(id);
+    if (it != _assets.end())
     {
-        auto mptr = std::make_unique<beam::wallet::WalletAssetMeta>(it->second);
-        return mptr;
+        return it->second;
     }
 
     collectAssetInfo(id);
-    return MetaPtr();
- }
 
-QString AssetsManager::getIcon(beam::Asset::ID id)
+    auto& placeholder = _unknown[id];
+    if (placeholder.name.isEmpty())
+    {
+        placeholder = makePlaceholder(id);
+    }
+    return placeholder;
+}
+
+AssetsManager::AssetInfo AssetsManager::makeInfo(beam::Asset::ID id, const QString& unitName, const QString& name, beam::Height lockHeight) const
 {
-     if (id < 1)
-     {
-         return "qrc:/assets/icon-beam.svg";
-     }
+    auto info = makePlaceholder(id);
+    info.metaUnitName = unitName;
+    info.metaName     = name;
+    info.lockHeight   = lockHeight;
+    info.icon         = _icons.at(static_cast<int>(id % _icons.size()));
+    info.color        = _colors.at(static_cast<int>(id % _colors.size()));
 
-     const auto it = _info.find(id);
-     if (it != _info.end())
-     {
-         auto idx = static_cast<int>(id % _icons.size());
-         return _icons[idx];
-     }
+    if (!unitName.isEmpty())
+    {
+        const int kMaxUnitLen = 6;
+        info.unitName = unitName;
+        info.shortUnitName = unitName.length() > kMaxUnitLen ? unitName.left(kMaxUnitLen) + u8"\u2026" : unitName;
+    }
 
-     return "qrc:/assets/asset-err.svg";
+    if (!name.isEmpty())
+    {
+        info.name = name;
+    }
+
+    return info;
 }
 
-QString AssetsManager::getUnitName(beam::Asset::ID id, bool shorten)
+AssetsManager::AssetInfo AssetsManager::makePlaceholder(beam::Asset::ID id) const
 {
-    if (id < 1)
+    AssetInfo info;
+    info.unitName = info.shortUnitName = "ASSET" + QString::number(id);
+    info.name  = "Asset " + QString::number(id);
+    info.icon  = "qrc:/assets/asset-err.svg";
+    info.color = QColor(255, 116, 107, 252);
+    return info;
+}
+
+void AssetsManager::loadCache()
+{
+    QFile file(_cachePath);
+    if (!file.open(QIODevice::ReadOnly))
     {
-        return "BEAM";
+        return;
     }
 
-    QString unitName;
-    if (auto meta = getAsset(id))
+    QDataStream stream(&file);
+    quint32 version = 0, count = 0;
+    stream >> version >> count;
+    if (version != kCacheVersion)
     {
-        unitName = meta->GetUnitName().c_str();
+        return;
     }
 
-    if (unitName.isEmpty())
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
     {
-        std::ostringstream ss;
-        ss << "ASSET" << static_cast<int>(id);
-        unitName = ss.str().c_str();
-        return unitName;
+        quint32 id = 0;
+        quint64 lockHeight = 0;
+        QString unitName, name;
+        stream >> id >> unitName >> name >> lockHeight;
+        if (stream.status() == QDataStream::Ok)
+        {
+            _assets[id] = makeInfo(id, unitName, name, lockHeight);
+        }
     }
 
-    const int kMaxUnitLen = 6;
-    if (shorten && unitName.length() > kMaxUnitLen)
+    if (stream.status() != QDataStream::Ok)
     {
-        unitName = unitName.left(kMaxUnitLen) + u8"\u2026";
+        LOG_WARNING() << "Assets cache is damaged: " << _cachePath.toStdString();
     }
-
-    return unitName;
 }
 
-QString AssetsManager::getName(beam::Asset::ID id)
+void AssetsManager::saveCache()
 {
-    if (id < 1)
-    {
-        return "Beam";
-    }
-
-    QString name;
-    if (auto meta = getAsset(id))
+    QSaveFile file(_cachePath);
+    if (!file.open(QIODevice::WriteOnly))
     {
-        name = meta->GetName().c_str();
+        LOG_WARNING() << "Failed to write assets cache: " << _cachePath.toStdString();
+        return;
     }
 
-    if (name.isEmpty())
+    QDataStream stream(&file);
+    stream << kCacheVersion << quint32(_assets.size());
+    for (const auto& p: _assets)
     {
-        std::ostringstream ss;
-        ss << "Asset " << static_cast<int>(id);
-        name = QString(ss.str().c_str());
+        stream << quint32(p.first) << p.second.metaUnitName << p.second.metaName << quint64(p.second.lockHeight);
     }
+    file.commit();
+}
 
-    return name;
+QString AssetsManager::getIcon(beam::Asset::ID id)
+{
+    return getInfo(id).icon;
 }
 
-QColor AssetsManager::getColor(beam::Asset::ID id)
+QString AssetsManager::getUnitName(beam::Asset::ID id, bool shorten)
 {
-    if (id < 1)
-    {
-        return QColor( 0, 246, 210, 252);
-    }
+    const auto& info = getInfo(id);
+    return shorten ? info.shortUnitName : info.unitName;
+}
 
-    const auto it = _info.find(id);
-     if (it != _info.end())
-     {
-         auto idx = static_cast<int>(id % _colors.size());
-         return _colors[idx];
-     }
+QString AssetsManager::getName(beam::Asset::ID id)
+{
+    return getInfo(id).name;
+}
 
-    return QColor( 255, 116, 107, 252);
+QColor AssetsManager::getColor(beam::Asset::ID id)
+{
+    return getInfo(id).color;
 }
 
 QColor AssetsManager::getSelectionColor(beam::Asset::ID id)
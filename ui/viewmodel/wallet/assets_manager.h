@@ -15,6 +15,7 @@
 
 #include <QObject>
 #include <QColor>
+#include <QTimer>
 #include "model/wallet_model.h"
 
 class AssetsManager: public QObject
@@ -23,8 +24,9 @@ class AssetsManager: public QObject
 public:
     typedef std::shared_ptr<AssetsManager> Ptr;
 
-    AssetsManager(WalletModel::Ptr wallet);
-    ~AssetsManager() override = default;
+    // @cachePath is the file of the asset names cache, names are known right away after restart
+    AssetsManager(WalletModel::Ptr wallet, const QString& cachePath);
+    ~AssetsManager() override;
 
     // SYNC
     QString getIcon(beam::Asset::ID);
@@ -34,21 +36,55 @@ public:
     QColor  getSelectionColor(beam::Asset::ID);
 
 signals:
-    void assetInfo(beam::Asset::ID assetId);
+    // Info of the assets has arrived or changed, answers of one batch of requests come together
+    void assetsInfoChanged(const std::set<beam::Asset::ID>& assetIds);
 
 private slots:
     void onAssetInfo(beam::Asset::ID, const beam::wallet::WalletAsset&);
 
 private:
-    // ASYNC
+    // ASYNC, unknown assets are collected over the event loop iteration and requested together
     void collectAssetInfo(beam::Asset::ID);
+    void sendRequests();
+    void notifyChanged(beam::Asset::ID);
+    void scheduleFlush();
+    void flushChanged();
 
-    typedef std::unique_ptr<beam::wallet::WalletAssetMeta> MetaPtr;
-    MetaPtr getAsset(beam::Asset::ID);
+    // Display values are built once when info arrives or is loaded from the cache,
+    // getters return implicitly shared copies without formatting anything
+    struct AssetInfo
+    {
+        QString unitName;
+        QString shortUnitName;
+        QString name;
+        QString icon;
+        QColor  color;
+
+        // as in the metadata, kept for the cache
+        QString metaUnitName;
+        QString metaName;
+        beam::Height lockHeight = 0;
+    };
+    const AssetInfo& getInfo(beam::Asset::ID);
+    AssetInfo makeInfo(beam::Asset::ID, const QString& unitName, const QString& name, beam::Height lockHeight) const;
+    AssetInfo makePlaceholder(beam::Asset::ID) const;
+    void loadCache();
+    void saveCache();
 
     WalletModel::Ptr _wallet;
-    std::map<beam::Asset::ID, beam::wallet::WalletAsset> _info;
     std::set<beam::Asset::ID> _requested;
+    std::set<beam::Asset::ID> _pending;
+    std::set<beam::Asset::ID> _changed;
+    QTimer _requestTimer;
+    QTimer _notifyTimer;
+
+    // known assets, from the previous runs until revalidated in background
+    std::map<beam::Asset::ID, AssetInfo> _assets;
+    // placeholders shown while info is requested
+    std::map<beam::Asset::ID, AssetInfo> _unknown;
+    AssetInfo _beam;
+    QString _cachePath;
+    QTimer _saveCacheTimer;
 
     std::map<int, QColor> _colors;
     std::map<int, QString> _icons;
@@ -23,6 +23,7 @@ AssetsViewModel::AssetsViewModel()
     : _wallet (*AppModel::getInstance().getWalletModel())
 {
     connect(&_wallet, &WalletModel::walletStatusChanged, this, &AssetsViewModel::onWalletStatus);
+    connect(&_wallet, &WalletModel::assetTotalsChanged, this, [this] () { _totalsChanged = true; });
 
     auto assetBEAM  = std::make_shared<AssetObject>(0);
 
@@ -42,8 +43,8 @@ void AssetsViewModel::formAssetsList()
 {
     VAssets all;
 
-    const auto assets = _wallet.getAssetsNZ();
-    for (auto assetId: assets)
+    _assetIds = _wallet.getAssetsNZ();
+    for (auto assetId: _assetIds)
     {
         /* bool found = false;
         for (const auto& asset: _assets)
@@ -67,8 +68,17 @@ void AssetsViewModel::formAssetsList()
 
 void AssetsViewModel::onWalletStatus()
 {
-    formAssetsList();
-    emit assetsChanged();
+    if (!_totalsChanged)
+    {
+        return;
+    }
+    _totalsChanged = false;
+
+    if (_wallet.getAssetsNZ() != _assetIds)
+    {
+        formAssetsList();
+        emit assetsChanged();
+    }
 }
 
 
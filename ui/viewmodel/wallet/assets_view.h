@@ -43,4 +43,7 @@ private:
     bool         _folded;
     AssetsList   _assets;
     WalletModel& _wallet;
+    // assets of the current list, rebuilt only when this set changes
+    std::set<beam::Asset::ID> _assetIds;
+    bool         _totalsChanged = false;
 };
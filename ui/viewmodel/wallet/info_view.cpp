@@ -23,12 +23,13 @@ namespace {
 InfoViewModel::InfoViewModel()
     : _wallet(*AppModel::getInstance().getWalletModel())
     , _amgr(AppModel::getInstance().getAssets())
+    , _ermgr(AppModel::getInstance().getRates())
     , _selectedAssetID(-1)
 {
     connect(&_wallet,    &WalletModel::walletStatusChanged,        this,  &InfoViewModel::onWalletStatus);
-    connect(_amgr.get(), &AssetsManager::assetInfo,                this,  &InfoViewModel::onAssetInfo);
-    connect(&_ermgr,     &ExchangeRatesManager::rateUnitChanged,   this,  &InfoViewModel::assetChanged);
-    connect(&_ermgr,     &ExchangeRatesManager::activeRateChanged, this,  &InfoViewModel::assetChanged);
+    connect(&_wallet,    &WalletModel::assetTotalsChanged,         this,  [this] (beam::Asset::ID assetId) { _changedAssets.insert(assetId); });
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged,        this,  &InfoViewModel::onAssetsInfo);
+    _ermgr->subscribe(beam::wallet::ExchangeRate::Currency::Beam, this, &InfoViewModel::onRateChanged);
 
     updateProgress();
     _wallet.getAsync()->getWalletStatus();
@@ -59,13 +60,13 @@ QString InfoViewModel::assetName() const
     return _amgr->getName(assetIdxToId(_selectedAssetID));
 }
 
-void InfoViewModel::onAssetInfo(beam::Asset::ID assetId)
+void InfoViewModel::onAssetsInfo(const std::set<beam::Asset::ID>& assetIds)
 {
-    bool found = std::find_if(_progress.begin(), _progress.end(), [&assetId](const auto& inp) {
-        return inp.assetId == assetId;
+    bool found = std::find_if(_progress.begin(), _progress.end(), [&assetIds](const auto& inp) {
+        return assetIds.count(inp.assetId) > 0;
     }) != _progress.end();
 
-    if (assetId == beam::Asset::ID(_selectedAssetID)  || found)
+    if (assetIds.count(beam::Asset::ID(_selectedAssetID)) || found)
     {
         updateProgress();
         emit assetChanged();
@@ -74,12 +75,12 @@ void InfoViewModel::onAssetInfo(beam::Asset::ID assetId)
 
 QString InfoViewModel::getRateUnit() const
 {
-    return _selectedAssetID < 1 ? beamui::getCurrencyUnitName(_ermgr.getRateUnitRaw()) : "";
+    return _selectedAssetID < 1 ? beamui::getCurrencyUnitName(_ermgr->getRateUnitRaw()) : "";
 }
 
 QString InfoViewModel::getRate() const
 {
-    auto rate = _ermgr.getRate(beam::wallet::ExchangeRate::Currency::Beam);
+    auto rate = _ermgr->getRate(beam::wallet::ExchangeRate::Currency::Beam);
     return _selectedAssetID < 1 ? beamui::AmountToUIString(rate) : "0";
 }
 
@@ -100,7 +101,26 @@ void InfoViewModel::setSelectedAsset(int newAsset)
 
 void InfoViewModel::onWalletStatus()
 {
-    updateProgress();
+    if (_changedAssets.empty())
+    {
+        return;
+    }
+
+    for (auto assetId: _changedAssets)
+    {
+        updateAssetProgress(assetId);
+    }
+    _changedAssets.clear();
+
+    updateTotals();
+    emit assetChanged();
+}
+
+void InfoViewModel::onRateChanged()
+{
+    // Beam progress keeps the rate and its unit, totals take them from there
+    updateAssetProgress(beam::Asset::s_BeamID);
+    updateTotals();
     emit assetChanged();
 }
 
@@ -115,10 +135,92 @@ InProgress InfoViewModel::getProgressTotal() const
 }
 
 void InfoViewModel::updateProgress()
+{
+    _progress.clear();
+
+    for(auto asset: _wallet.getAssetsNZ())
+    {
+        InProgress progress;
+        if (makeProgress(asset, progress))
+        {
+            _progress.push_back(progress);
+        }
+    }
+
+    updateTotals();
+}
+
+void InfoViewModel::updateAssetProgress(beam::Asset::ID assetId)
+{
+    auto it = std::lower_bound(_progress.begin(), _progress.end(), assetId, [] (const InProgress& progress, beam::Asset::ID id) {
+        return progress.assetId < id;
+    });
+    const bool found = it != _progress.end() && it->assetId == assetId;
+
+    InProgress progress;
+    if (makeProgress(assetId, progress))
+    {
+        if (found)
+        {
+            *it = progress;
+        }
+        else
+        {
+            _progress.insert(it, progress);
+        }
+    }
+    else if (found)
+    {
+        _progress.erase(it);
+    }
+}
+
+bool InfoViewModel::makeProgress(beam::Asset::ID asset, InProgress& progress)
+{
+    using namespace beam::wallet;
+
+    progress.assetId = asset;
+
+    auto sending    = _wallet.getSending(asset);
+    auto receiving  = _wallet.getReceiving(asset);
+    auto change     = _wallet.getReceivingChange(asset);
+    auto incoming   = _wallet.getReceivingIncoming(asset);
+    auto maturing   = _wallet.getMaturing(asset);
+    auto maturingMP = _wallet.getMatutingMP(asset);
+    auto locked     = maturing; locked += maturingMP;
+
+    if (sending == Zero && receiving == Zero && change == Zero && incoming == Zero && locked == Zero && maturing == Zero && maturingMP == Zero)
+    {
+        return false;
+    }
+
+    progress.sending           = beamui::AmountBigToUIString(sending);
+    progress.receiving         = beamui::AmountBigToUIString(receiving);
+    progress.receivingChange   = beamui::AmountBigToUIString(change);
+    progress.receivingIncoming = beamui::AmountBigToUIString(incoming);
+    progress.locked            = beamui::AmountBigToUIString(locked);
+    progress.lockedMaturing    = beamui::AmountBigToUIString(maturing);
+    progress.lockedMaturingMP  = beamui::AmountBigToUIString(maturingMP);
+    progress.icon              = _amgr->getIcon(asset);
+    progress.unitName          = _amgr->getUnitName(asset, false);
+
+    if (asset == 0)
+    {
+        progress.rate =  beamui::AmountToUIString(_ermgr->getRate(ExchangeRate::Currency::Beam));
+        progress.rateUnit = beamui::getCurrencyUnitName(_ermgr->getRateUnitRaw());
+    }
+    else
+    {
+        progress.rate = "0";
+    }
+
+    return true;
+}
+
+void InfoViewModel::updateTotals()
 {
     using namespace beam::wallet;
 
-    _progress.clear();
     _progressTotals = InProgress();
 
     beam::AmountBig::Type sendingTotal    = Zero;
@@ -130,57 +232,26 @@ void InfoViewModel::updateProgress()
     beam::AmountBig::Type maturingMPTotal = Zero;
     QString receivingUnit;
 
-    auto assets = _wallet.getAssetsNZ();
-    for(auto& asset: assets)
+    for(const auto& progress: _progress)
     {
-        InProgress progress;
-        progress.assetId = asset;
-
-        auto sending    = _wallet.getSending(asset);
-        auto receiving  = _wallet.getReceiving(asset);
-        auto change     = _wallet.getReceivingChange(asset);
-        auto incoming   = _wallet.getReceivingIncoming(asset);
-        auto maturing   = _wallet.getMaturing(asset);
-        auto maturingMP = _wallet.getMatutingMP(asset);
-        auto locked     = maturing; locked += maturingMP;
+        const auto asset = progress.assetId;
+        auto receiving   = _wallet.getReceiving(asset);
+        auto maturing    = _wallet.getMaturing(asset);
+        auto maturingMP  = _wallet.getMatutingMP(asset);
 
-        if (sending != Zero || receiving != Zero || change != Zero || incoming != Zero || locked != Zero || maturing != Zero || maturingMP != Zero)
+        if (receiving != Zero)
         {
-            progress.sending           = beamui::AmountBigToUIString(sending);
-            progress.receiving         = beamui::AmountBigToUIString(receiving);
-            progress.receivingChange   = beamui::AmountBigToUIString(change);
-            progress.receivingIncoming = beamui::AmountBigToUIString(incoming);
-            progress.locked            = beamui::AmountBigToUIString(locked);
-            progress.lockedMaturing    = beamui::AmountBigToUIString(maturing);
-            progress.lockedMaturingMP  = beamui::AmountBigToUIString(maturingMP);
-            progress.icon              = _amgr->getIcon(asset);
-            progress.unitName          = _amgr->getUnitName(asset, false);
-
-            if (asset == 0)
-            {
-                progress.rate =  beamui::AmountToUIString(_ermgr.getRate(ExchangeRate::Currency::Beam));
-                progress.rateUnit = beamui::getCurrencyUnitName(_ermgr.getRateUnitRaw());
-            }
-            else
-            {
-                progress.rate = "0";
-            }
-
-            _progress.push_back(progress);
-            sendingTotal    += sending;
-
-            if (receiving != Zero)
-            {
-                receivingUnit = receivingTotal == Zero ? progress.unitName : "ASSETS";
-            }
-
-            receivingTotal  += receiving;
-            changeTotal     += change;
-            incomingTotal   += incoming;
-            lockedTotal     += locked;
-            maturingTotal   += maturing;
-            maturingMPTotal += maturingMP;
+            receivingUnit = receivingTotal == Zero ? progress.unitName : "ASSETS";
         }
+
+        sendingTotal    += _wallet.getSending(asset);
+        receivingTotal  += receiving;
+        changeTotal     += _wallet.getReceivingChange(asset);
+        incomingTotal   += _wallet.getReceivingIncoming(asset);
+        lockedTotal     += maturing;
+        lockedTotal     += maturingMP;
+        maturingTotal   += maturing;
+        maturingMPTotal += maturingMP;
     }
 
     _progressTotals.sending           = beamui::AmountBigToUIString(sendingTotal);
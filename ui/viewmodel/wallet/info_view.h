@@ -135,16 +135,22 @@ signals:
     void assetChanged();
 
 private slots:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const std::set<beam::Asset::ID>& assetIds);
     void onWalletStatus();
+    void onRateChanged();
 
 private:
     void updateProgress();
+    void updateAssetProgress(beam::Asset::ID assetId);
+    void updateTotals();
+    bool makeProgress(beam::Asset::ID assetId, InProgress& progress);
 
     WalletModel&           _wallet;
     AssetsManager::Ptr     _amgr;
-    ExchangeRatesManager   _ermgr;
+    ExchangeRatesManager::Ptr _ermgr;
     int                    _selectedAssetID; // can be -1
     QList<InProgress>      _progress;
     InProgress             _progressTotals;
+    // assets with changed totals, applied together on walletStatusChanged
+    std::set<beam::Asset::ID> _changedAssets;
 };
@@ -14,7 +14,6 @@
 #include "tx_object.h"
 #include "viewmodel/ui_helpers.h"
 #include "wallet/core/common.h"
-#include "wallet/core/simple_transaction.h"
 #include "wallet/core/strings_resources.h"
 #include "model/app_model.h"
 
@@ -24,14 +23,12 @@ using namespace beamui;
 
 namespace
 {
-    QString getWaitingPeerStr(const beam::wallet::TxParameters& txParameters, bool isSender)
+    QString getWaitingPeerStr(const TxRow& row, bool isSender)
     {
-        auto minHeight = txParameters.GetParameter<beam::Height>(TxParameterID::MinHeight);
-        auto responseTime = txParameters.GetParameter<beam::Height>(TxParameterID::PeerResponseTime);
         QString time = "";
-        if (minHeight && responseTime)
+        if (row.minHeight && row.peerResponseTime)
         {
-            time = convertBeamHeightDiffToTime(*minHeight + *responseTime - AppModel::getInstance().getWalletModel()->getCurrentHeight());
+            time = convertBeamHeightDiffToTime(row.minHeight + row.peerResponseTime - AppModel::getInstance().getWalletModel()->getCurrentHeight());
         }
         if (isSender)
         {
@@ -42,30 +39,28 @@ namespace
         return qtTrId("tx-state-initial-receiver").arg(time);
     }
 
-    QString getInProgressStr(const beam::wallet::TxParameters& txParameters)
+    QString getInProgressStr(const TxRow& row)
     {
         const Height kNormalTxConfirmationDelay = 10;
-        auto maxHeight = txParameters.GetParameter<beam::Height>(TxParameterID::MaxHeight);
         QString time = "";
-        if (!maxHeight)
+        if (!row.maxHeight)
         {
             return "";
         }
 
         auto currentHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
-        if (currentHeight >= *maxHeight)
+        if (currentHeight >= row.maxHeight)
         {
             return "";
         }
 
-        Height delta =  *maxHeight - currentHeight;
-        auto lifetime = txParameters.GetParameter<beam::Height>(TxParameterID::Lifetime);
-        if (!lifetime || *lifetime < delta)
+        Height delta =  row.maxHeight - currentHeight;
+        if (!row.lifetime || row.lifetime < delta)
         {
             return "";
         }
 
-        if (*lifetime - delta <= kNormalTxConfirmationDelay)
+        if (row.lifetime - delta <= kNormalTxConfirmationDelay)
         {
             //% "The transaction is usually expected to complete in a few minutes."
             return qtTrId("tx-state-in-progress-normal");
@@ -79,43 +74,41 @@ namespace
         //% "It is taking longer than usual. In case the transaction could not be completed it will be canceled automatically in %1."
         return qtTrId("tx-state-in-progress-long").arg(time);
     }
-}
-
 
-TxObject::TxObject( const TxDescription& tx,
-                    QObject* parent/* = nullptr*/)
-        : TxObject(tx, beam::wallet::ExchangeRate::Currency::Unknown, parent)
-{
+    beam::Amount getStoredRate(const TxRow& row, ExchangeRate::Currency secondCurrency)
+    {
+        for (const auto& rate : row.rates)
+        {
+            if (rate.m_unit == secondCurrency)
+            {
+                return rate.m_rate;
+            }
+        }
+        return 0;
+    }
 }
 
-TxObject::TxObject( const TxDescription& tx,
+
+TxObject::TxObject( TxRow::Ptr row,
                     beam::wallet::ExchangeRate::Currency secondCurrency,
+                    const RateHistory* rateHistory/* = nullptr*/,
                     QObject* parent/* = nullptr*/)
         : QObject(parent)
-        , m_tx(tx)
-        , m_type(*m_tx.GetParameter<TxType>(TxParameterID::TransactionType))
-        , m_secondCurrency(secondCurrency)
+        , m_row(std::move(row))
+        , m_type(m_row->txType)
+        , m_rate(getStoredRate(*m_row, secondCurrency))
 {
-    m_kernelID = QString::fromStdString(to_hex(tx.m_kernelID.m_pData, tx.m_kernelID.nBytes));
-    if (m_tx.m_txType == TxType::Contract)
+    if (!m_rate && rateHistory && m_row->assetId == Asset::s_BeamID)
     {
-        _contractAmount = 0;
-        visitContractData([this](const beam::bvm2::ContractInvokeData &data) {
-            for (const auto &spend: data.m_Spend)
-            {
-                _contractAssets.insert(spend.first);
-                // TODO: this potentially can overflow
-                _contractAmount -= spend.second;
-                _contractFee += data.m_Fee;
-            }
-        });
-
-        if (_contractAmount > 0) {
-            _contractAmount -= _contractFee;
-        }
+        m_rate = rateHistory->getRate(ExchangeRate::Currency::Beam, secondCurrency, m_row->createTime);
     }
 }
 
+const TxRow::Ptr& TxObject::getRow() const
+{
+    return m_row;
+}
+
 bool TxObject::operator==(const TxObject& other) const
 {
     return getTxID() == other.getTxID();
@@ -123,37 +116,34 @@ bool TxObject::operator==(const TxObject& other) const
 
 auto TxObject::timeCreated() const -> beam::Timestamp
 {
-    return m_tx.m_createTime;
+    return m_row->createTime;
 }
 
 auto TxObject::getTxID() const -> beam::wallet::TxID
 {
-    return m_tx.m_txId;
+    return m_row->txId;
 }
 
 bool TxObject::isIncome() const
 {
-    if (isContractTx())
-    {
-        return _contractAmount > 0;
-    }
-    else
-    {
-        return m_tx.m_sender == false;
-    }
+    return m_row->income;
 }
 
 QString TxObject::getComment() const
 {
-    std::string str{m_tx.m_message.begin(), m_tx.m_message.end()};
-    auto comment = QString(str.c_str()).trimmed();
+    return getComment(*m_row);
+}
+
+QString TxObject::getComment(const TxRow& row)
+{
+    const auto& comment = row.comment;
 
-    if (isContractTx())
+    if (row.txType == TxType::Contract)
     {
         //% "Contract transaction"
         return comment.isEmpty() ? qtTrId("tx-contract-default-comment") : comment;
     }
-    else if (isDexTx())
+    else if (row.txType == TxType::DexSimpleSwap)
     {
         // TODO:DEX just temporary
         return "DEX transaction";
@@ -166,152 +156,87 @@ QString TxObject::getComment() const
 
 QString TxObject::getAmount() const
 {
-    if (isContractTx())
-    {
-        return AmountToUIString(std::abs(_contractAmount));
-    }
-    else
-    {
-        return AmountToUIString(m_tx.m_amount);
-    }
+    return AmountToUIString(m_row->amount);
 }
 
 beam::Amount TxObject::getAmountValue() const
 {
-    if (isContractTx())
-    {
-        return std::abs(_contractAmount);
-    }
-    else
-    {
-        return m_tx.m_amount;
-    }
+    return m_row->amount;
 }
 
 QString TxObject::getRate() const
 {
-    if (m_tx.m_assetId != Asset::s_BeamID)
+    if (m_row->assetId != Asset::s_BeamID)
     {
         return "0";
     }
 
-    auto exchangeRatesOptional = getTxDescription().GetParameter<std::vector<ExchangeRate>>(TxParameterID::ExchangeRates);
-    if (exchangeRatesOptional)
-    {
-        std::vector<ExchangeRate>& rates = *exchangeRatesOptional;
-        auto secondCurrency = m_secondCurrency;
-        auto search = std::find_if(std::begin(rates),
-                                   std::end(rates),
-                                   [secondCurrency](const ExchangeRate& r)
-                                   {
-                                       return r.m_currency == ExchangeRate::Currency::Beam
-                                           && r.m_unit == secondCurrency;
-                                   });
-        if (search != std::cend(rates))
-        {
-            return AmountToUIString(search->m_rate);
-        }
-    }
-
-    return "0";
+    return AmountToUIString(m_rate);
 }
 
-QString TxObject::getStatus() const
+auto TxObject::getStatusCode() const -> Status
 {
-    if (m_tx.m_txType == wallet::TxType::Simple)
-    {
-        SimpleTxStatusInterpreter interpreter(m_tx);
-        return interpreter.getStatus().c_str();
-    }
-    else if (m_tx.m_txType == wallet::TxType::PushTransaction)
-    {
-        MaxPrivacyTxStatusInterpreter interpreter(m_tx);
-        return interpreter.getStatus().c_str();
-    }
-    else if (m_tx.m_txType >= wallet::TxType::AssetIssue && m_tx.m_txType <= wallet::TxType::AssetInfo)
-    {
-        AssetTxStatusInterpreter interpreter(m_tx);
-        return interpreter.getStatus().c_str();
-    }
-    else if (m_tx.m_txType == wallet::TxType::Contract)
-    {
-        ContractTxStatusInterpreter interpreter(m_tx);
-        return interpreter.getStatus().c_str();
-    }
-    else if (m_tx.m_txType == wallet::TxType::DexSimpleSwap)
-    {
-        // TODO:DEX implement
-        return "NOT IMPLEMENTED";
-    }
-    else
-    {
-        BOOST_ASSERT_MSG(false, kErrorUnknownTxType);
-        return "unknown";
-    }
+    return m_row->statusCode;
 }
 
 bool TxObject::isCancelAvailable() const
 {
-    return m_tx.canCancel();
+    return m_row->canCancel;
 }
 
 bool TxObject::isDeleteAvailable() const
 {
-    return m_tx.canDelete();
+    return m_row->canDelete;
 }
 
 QString TxObject::getAddressFrom() const
 {
-    if (m_tx.m_txType == wallet::TxType::PushTransaction && !m_tx.m_sender)
+    return getAddressFrom(*m_row);
+}
+
+QString TxObject::getAddressFrom(const TxRow& row)
+{
+    if (row.txType == wallet::TxType::PushTransaction && !row.sender)
     {
-        return getSenderIdentity();
+        return row.senderIdentity;
     }
-    return toString(m_tx.m_sender ? m_tx.m_myId : m_tx.m_peerId);
+    return row.sender ? row.myAddress : row.peerAddress;
 }
 
 QString TxObject::getAddressTo() const
 {
-    if (m_tx.m_sender)
+    return getAddressTo(*m_row);
+}
+
+QString TxObject::getAddressTo(const TxRow& row)
+{
+    if (row.sender)
     {
-        auto token = getToken();
-        if (token.isEmpty())
-            return toString(m_tx.m_peerId);
+        if (row.token.isEmpty())
+            return row.peerAddress;
 
-        return token;
+        return row.token;
     }
-    return toString(m_tx.m_myId);
+    return row.myAddress;
 }
 
 QString TxObject::getFee() const
 {
-    if (isContractTx())
+    if (m_row->fee)
     {
-        if (_contractFee)
-        {
-            return AmountInGrothToUIString(_contractFee);
-        }
-    }
-    else if (m_tx.m_fee)
-    {
-        Amount shieldedFee = GetShieldedFee(m_tx);
-        return AmountInGrothToUIString(shieldedFee + m_tx.m_fee);
+        return AmountInGrothToUIString(m_row->fee);
     }
     return QString{};
 }
 
-const beam::wallet::TxDescription& TxObject::getTxDescription() const
-{
-    return m_tx;
-}
-
 QString TxObject::getKernelID() const
 {
-    return m_kernelID;
+    return m_row->kernelID;
 }
 
 QString TxObject::getTransactionID() const
 {
-    return QString::fromStdString(to_hex(m_tx.m_txId.data(), m_tx.m_txId.size()));
+    return m_row->txIdHex;
 }
 
 QString TxObject::getReasonString(beam::wallet::TxFailureReason reason) const
@@ -442,9 +367,9 @@ QString TxObject::getReasonString(beam::wallet::TxFailureReason reason) const
 
 QString TxObject::getFailureReason() const
 {
-    if (getTxDescription().m_status == wallet::TxStatus::Failed)
+    if (m_row->status == wallet::TxStatus::Failed)
     {
-        return getReasonString(getTxDescription().m_failureReason);
+        return getReasonString(m_row->failureReason);
     }
 
     return QString();
@@ -452,37 +377,23 @@ QString TxObject::getFailureReason() const
 
 QString TxObject::getStateDetails() const
 {
-    auto& tx = getTxDescription();
-    if (tx.m_txType == beam::wallet::TxType::Simple)
+    const auto& row = *m_row;
+    if (row.txType == beam::wallet::TxType::Simple)
     {
-        switch (tx.m_status)
+        switch (row.status)
         {
         case beam::wallet::TxStatus::Pending:
         case beam::wallet::TxStatus::InProgress:
-        {
-            auto state = tx.GetParameter<wallet::SimpleTransaction::State>(TxParameterID::State);
-            if (state)
-            {
-                switch (*state)
-                {
-                case wallet::SimpleTransaction::Initial:
-                case wallet::SimpleTransaction::Invitation:
-                    return getWaitingPeerStr(tx, tx.m_sender);
-                default:
-                    break;
-                }
-            }
-            return getWaitingPeerStr(tx, tx.m_sender);
-        }
+            return getWaitingPeerStr(row, row.sender);
         case beam::wallet::TxStatus::Registering:
-            return getInProgressStr(tx);
+            return getInProgressStr(row);
         default:
             break;
         }
     }
 
-    if (tx.m_txType == beam::wallet::TxType::PushTransaction &&
-        (tx.m_status == beam::wallet::TxStatus::InProgress || tx.m_status == beam::wallet::TxStatus::Registering))
+    if (row.txType == beam::wallet::TxType::PushTransaction &&
+        (row.status == beam::wallet::TxStatus::InProgress || row.status == beam::wallet::TxStatus::Registering))
     {
         //% "The transaction is usually expected to complete in a few minutes."
         return qtTrId("tx-state-in-progress-normal");
@@ -492,41 +403,34 @@ QString TxObject::getStateDetails() const
 
 QString TxObject::getToken() const
 {
-    const auto& tx = getTxDescription();
-    return QString::fromStdString(tx.getToken());
+    return m_row->token;
 }
 
 QString TxObject::getSenderIdentity() const
 {
-    return QString::fromStdString(m_tx.getSenderIdentity());
+    return m_row->senderIdentity;
 }
 
 QString TxObject::getReceiverIdentity() const
 {
-    return QString::fromStdString(m_tx.getReceiverIdentity());
+    return m_row->receiverIdentity;
 }
 
 std::set<beam::Asset::ID> TxObject::getAssetsList() const
 {
     // TODO:DEX implement
-    if (isContractTx())
-    {
-        return _contractAssets;
-    }
-
-    std::set<beam::Asset::ID> alist = {m_tx.m_assetId};
-    return alist;
+    return std::set<beam::Asset::ID>(m_row->assets.begin(), m_row->assets.end());
 }
 
 bool TxObject::hasPaymentProof() const
 {
-    return !isIncome() && m_tx.m_status == wallet::TxStatus::Completed 
-        && (m_tx.m_txType == TxType::Simple || m_tx.m_txType == TxType::PushTransaction);
+    return !isIncome() && m_row->status == wallet::TxStatus::Completed
+        && (m_row->txType == TxType::Simple || m_row->txType == TxType::PushTransaction);
 }
 
 bool TxObject::isInProgress() const
 {
-    switch (m_tx.m_status)
+    switch (m_row->status)
     {
         case wallet::TxStatus::Pending:
         case wallet::TxStatus::InProgress:
@@ -539,42 +443,37 @@ bool TxObject::isInProgress() const
 
 bool TxObject::isPending() const
 {
-    return m_tx.m_status == wallet::TxStatus::Pending;
+    return m_row->status == wallet::TxStatus::Pending;
 }
 
 bool TxObject::isCompleted() const
 {
-    return m_tx.m_status == wallet::TxStatus::Completed;
+    return m_row->status == wallet::TxStatus::Completed;
 }
 
 bool TxObject::isSelfTx() const
 {
-    return m_tx.m_selfTx;
+    return m_row->selfTx;
 }
 
 bool TxObject::isShieldedTx() const
 {
-    return m_tx.m_txType == TxType::PushTransaction;
+    return m_row->txType == TxType::PushTransaction;
 }
 
 bool TxObject::isContractTx() const
 {
-    return m_tx.m_txType == TxType::Contract;
+    return m_row->txType == TxType::Contract;
 }
 
 bool TxObject::isDexTx() const
 {
-    return m_tx.m_txType == TxType::DexSimpleSwap;
+    return m_row->txType == TxType::DexSimpleSwap;
 }
 
-beam::wallet::TxAddressType TxObject::getAddressType()
+beam::wallet::TxAddressType TxObject::getAddressType() const
 {
-    restoreAddressType();
-
-    if (m_addressType)
-        return *m_addressType;
-
-    return TxAddressType::Unknown;
+    return m_row->addressType;
 }
 
 bool TxObject::isSent() const
@@ -589,43 +488,15 @@ bool TxObject::isReceived() const
 
 bool TxObject::isCanceled() const
 {
-    return m_tx.m_status == wallet::TxStatus::Canceled;
+    return m_row->status == wallet::TxStatus::Canceled;
 }
 
 bool TxObject::isFailed() const
 {
-    return m_tx.m_status == wallet::TxStatus::Failed;
+    return m_row->status == wallet::TxStatus::Failed;
 }
 
 bool TxObject::isExpired() const
 {
-    return isFailed() && m_tx.m_failureReason == TxFailureReason::TransactionExpired;
-}
-
-void TxObject::restoreAddressType()
-{
-    auto storedType = m_tx.GetParameter<TxAddressType>(TxParameterID::AddressType);
-    if (storedType)
-    {
-        m_addressType = storedType;
-        return;
-    }
-
-    if (!m_tx.m_sender || m_addressType)
-        return;
-
-    m_addressType = GetAddressType(m_tx);
-    m_tx.SetParameter(TxParameterID::AddressType, *m_addressType);
-}
-
-void TxObject::visitContractData(const CDVisitor& visitor) const
-{
-    std::vector<beam::bvm2::ContractInvokeData> vData;
-    if(m_tx.GetParameter(TxParameterID::ContractDataPacked, vData))
-    {
-        for (const auto& data: vData)
-        {
-            visitor(data);
-        }
-    }
+    return isFailed() && m_row->failureReason == TxFailureReason::TransactionExpired;
 }
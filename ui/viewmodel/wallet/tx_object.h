@@ -17,21 +17,30 @@
 #include <QDateTime>
 #include "viewmodel/payment_item.h"
 #include "viewmodel/ui_helpers.h"
+#include "model/rate_history.h"
+#include "model/tx_row.h"
 #include "wallet/client/extensions/news_channels/interface.h"
-#include "bvm/ManagerStd.h"
 
 class TxObject : public QObject
 {
     Q_OBJECT
 
 public:
-    TxObject(const beam::wallet::TxDescription& tx,
-             QObject* parent = nullptr);
-    TxObject(const beam::wallet::TxDescription& tx,
+    using Status = TxRow::Status;
+
+    // Keeps only the projected row, shared with TxStore.
+    // @rateHistory gives the rate for transactions stored without it
+    TxObject(TxRow::Ptr row,
              beam::wallet::ExchangeRate::Currency secondCurrency,
+             const RateHistory* rateHistory = nullptr,
              QObject* parent = nullptr);
     bool operator==(const TxObject& other) const;
 
+    // Texts of the rows which are not loaded into objects yet are formatted the same way, see TxObjectList
+    static QString getComment(const TxRow& row);
+    static QString getAddressFrom(const TxRow& row);
+    static QString getAddressTo(const TxRow& row);
+
     beam::Timestamp timeCreated() const;
     beam::wallet::TxID getTxID() const;
     beam::Amount getAmountValue() const;
@@ -44,20 +53,21 @@ public:
     QString getKernelID() const;
     QString getTransactionID() const ;
     bool hasPaymentProof() const;
-    virtual QString getStatus() const;
+    Status getStatusCode() const;
     virtual QString getFailureReason() const;
     virtual QString getStateDetails() const;
     QString getToken() const;
     QString getSenderIdentity() const;
     QString getReceiverIdentity() const;
     std::set<beam::Asset::ID> getAssetsList() const;
+    const TxRow::Ptr& getRow() const;
 
     bool isIncome() const;
     bool isSelfTx() const;
     bool isShieldedTx() const;
     bool isContractTx() const;
     bool isDexTx() const;
-    beam::wallet::TxAddressType getAddressType();
+    beam::wallet::TxAddressType getAddressType() const;
     bool isSent() const;
     bool isReceived() const;
     virtual bool isCancelAvailable() const;
@@ -70,24 +80,11 @@ public:
     virtual bool isFailed() const;
 
 protected:
-    const beam::wallet::TxDescription& getTxDescription() const;
     QString getReasonString(beam::wallet::TxFailureReason reason) const;
     QString getIdentity(bool isSender) const;
-    void restoreAddressType();
- 
-    beam::wallet::TxDescription m_tx;
-    QString m_kernelID;
-    beam::wallet::TxType m_type;
-    beam::wallet::ExchangeRate::Currency m_secondCurrency;
-    mutable  boost::optional<bool> m_hasVouchers;
-    boost::optional<beam::wallet::TxAddressType> m_addressType;
 
-    //
-    // Contracts handling
-    //
-    typedef std::function<void (const beam::bvm2::ContractInvokeData& data)> CDVisitor;
-    void visitContractData(const CDVisitor&) const;
-    beam::AmountSigned _contractAmount = 0;
-    beam::Amount _contractFee = 0U;
-    std::set<beam::Asset::ID> _contractAssets;
+    TxRow::Ptr m_row;
+    beam::wallet::TxType m_type;
+    // Beam rate in the second currency at the transaction time, 0 if unknown
+    beam::Amount m_rate = 0;
 };
@@ -14,173 +14,164 @@
 
 #include "tx_object_list.h"
 #include "model/app_model.h"
+#include <array>
 
 namespace
 {
     using namespace beam::wallet;
 
-QString getStatusTextTranslated(const QString& status, TxAddressType addressType)
+typedef std::array<QString, static_cast<size_t>(TxObject::Status::Count)> StatusTexts;
+
+// Translated once per locale, see TxObjectList::onLocaleChanged
+bool g_statusTextsValid = false;
+
+StatusTexts buildStatusTexts()
 {
-    if (status == "pending")
-    {
+    StatusTexts texts;
+    texts[static_cast<size_t>(TxObject::Status::Pending)] =
         //% "pending"
-        return qtTrId("wallet-txs-status-pending");
-    }
-    else if (status == "waiting for sender")
-    {
+        qtTrId("wallet-txs-status-pending");
+    texts[static_cast<size_t>(TxObject::Status::WaitingForSender)] =
         //% "waiting for sender"
-        return qtTrId("wallet-txs-status-waiting-sender");
-    }
-    else if (status == "waiting for receiver")
-    {
+        qtTrId("wallet-txs-status-waiting-sender");
+    texts[static_cast<size_t>(TxObject::Status::WaitingForReceiver)] =
         //% "waiting for receiver"
-        return qtTrId("wallet-txs-status-waiting-receiver");
-    }
-    else if (status == "in progress")
-    {
+        qtTrId("wallet-txs-status-waiting-receiver");
+    texts[static_cast<size_t>(TxObject::Status::InProgress)] =
         //% "in progress"
-        return qtTrId("wallet-txs-status-in-progress");
-    }
-    else if (status == "sent to own address")
-    {
+        qtTrId("wallet-txs-status-in-progress");
+    texts[static_cast<size_t>(TxObject::Status::SentToOwnAddress)] =
         //% "sent to own address"
-        return qtTrId("wallet-txs-status-own-sent");
-    }
-    else if (status == "sending to own address")
-    {
+        qtTrId("wallet-txs-status-own-sent");
+    texts[static_cast<size_t>(TxObject::Status::SendingToOwnAddress)] =
         //% "sending to own address"
-        return qtTrId("wallet-txs-status-own-sending");
-    }
-    else if (status == "received")
-    {
+        qtTrId("wallet-txs-status-own-sending");
+    texts[static_cast<size_t>(TxObject::Status::Received)] =
         //% "received"
-        return qtTrId("wallet-txs-status-received");
-    }
-    else if (status == "sent")
-    {
+        qtTrId("wallet-txs-status-received");
+    texts[static_cast<size_t>(TxObject::Status::Sent)] =
         //% "sent"
-        return qtTrId("wallet-txs-status-sent");
-    }
-    else if (status == "cancelled")
-    {
+        qtTrId("wallet-txs-status-sent");
+    texts[static_cast<size_t>(TxObject::Status::Cancelled)] =
         //% "cancelled"
-        return qtTrId("wallet-txs-status-cancelled");
-    }
-    else if (status == "expired")
-    {
+        qtTrId("wallet-txs-status-cancelled");
+    texts[static_cast<size_t>(TxObject::Status::Expired)] =
         //% "expired"
-        return qtTrId("wallet-txs-status-expired");
-    }
-    else if (status == "failed")
-    {
+        qtTrId("wallet-txs-status-expired");
+    texts[static_cast<size_t>(TxObject::Status::Failed)] =
         //% "failed"
-        return qtTrId("wallet-txs-status-failed");
-    }
-    // in progress
-    else if (status == "in progress max privacy")
-    {
+        qtTrId("wallet-txs-status-failed");
+    texts[static_cast<size_t>(TxObject::Status::InProgressMaxPrivacy)] =
         /*% "in progress
 max privacy" */
-        return qtTrId("wallet-txs-status-in-progress-max");
-    }
-    else if (status == "in progress offline")
-    {
+        qtTrId("wallet-txs-status-in-progress-max");
+    texts[static_cast<size_t>(TxObject::Status::InProgressOffline)] =
         /*% "in progress
 offline" */
-        return qtTrId("wallet-txs-status-in-progress-max-offline");
-    }
-    else if (status == "in progress public offline")
-    {
+        qtTrId("wallet-txs-status-in-progress-max-offline");
+    texts[static_cast<size_t>(TxObject::Status::InProgressPublicOffline)] =
         /*% "in progress
 public offline" */
-        return qtTrId("wallet-txs-status-in-progress-public-offline");
-    }
-    // sent
-    else if (status == "sent max privacy")
-    {
+        qtTrId("wallet-txs-status-in-progress-public-offline");
+    texts[static_cast<size_t>(TxObject::Status::SentMaxPrivacy)] =
         /*% "sent
 max privacy"*/
-        return qtTrId("wallet-txs-status-sent-max");
-    }
-    else if (status == "sent offline")
-    {
+        qtTrId("wallet-txs-status-sent-max");
+    texts[static_cast<size_t>(TxObject::Status::SentOffline)] =
         /*% "sent
 offline" */
-        return qtTrId("wallet-txs-status-sent-max-offline");
-    }
-    else if (status == "sent public offline")
-    {
+        qtTrId("wallet-txs-status-sent-max-offline");
+    texts[static_cast<size_t>(TxObject::Status::SentPublicOffline)] =
         /*% "sent
 public offline" */
-        return qtTrId("wallet-txs-status-sent-public-offline");
-    }
-    // received
-    else if (status == "received max privacy")
-    {
+        qtTrId("wallet-txs-status-sent-public-offline");
+    texts[static_cast<size_t>(TxObject::Status::ReceivedMaxPrivacy)] =
         /*% "received
 max privacy" */
-        return qtTrId("wallet-txs-status-received-max");
-    }
-    else if (status == "received offline")
-    {
+        qtTrId("wallet-txs-status-received-max");
+    texts[static_cast<size_t>(TxObject::Status::ReceivedOffline)] =
         /*% "received
 offline" */
-        return qtTrId("wallet-txs-status-received-max-offline");
-    }
-    else if (status == "received public offline")
-    {
+        qtTrId("wallet-txs-status-received-max-offline");
+    texts[static_cast<size_t>(TxObject::Status::ReceivedPublicOffline)] =
         /*% "received
 public offline" */
-        return qtTrId("wallet-txs-status-received-public-offline");
-    }
-    // canceled
-    else if (status == "canceled max privacy")
-    {
+        qtTrId("wallet-txs-status-received-public-offline");
+    texts[static_cast<size_t>(TxObject::Status::CanceledMaxPrivacy)] =
         /*% "canceled
 max privacy" */
-        return qtTrId("wallet-txs-status-canceled-max");
-    }
-    else if (status == "canceled offline")
-    {
+        qtTrId("wallet-txs-status-canceled-max");
+    texts[static_cast<size_t>(TxObject::Status::CanceledOffline)] =
         /*% "canceled
 offline" */
-        return qtTrId("wallet-txs-status-canceled-max-offline");
-    }
-    else if (status == "canceled public offline")
-    {
+        qtTrId("wallet-txs-status-canceled-max-offline");
+    texts[static_cast<size_t>(TxObject::Status::CanceledPublicOffline)] =
         /*% "canceled
 public offline" */
-        return qtTrId("wallet-txs-status-canceled-public-offline");
-    }
-    // failed
-    else if (status == "failed max privacy")
-    {
+        qtTrId("wallet-txs-status-canceled-public-offline");
+    texts[static_cast<size_t>(TxObject::Status::FailedMaxPrivacy)] =
         /*% "failed
 max privacy" */
-        return qtTrId("wallet-txs-status-failed-max");
-    }
-    else if (status == "failed offline")
-    {
+        qtTrId("wallet-txs-status-failed-max");
+    texts[static_cast<size_t>(TxObject::Status::FailedOffline)] =
         /*% "failed
 offline" */
-        return qtTrId("wallet-txs-status-failed-max-offline");
-    }
-    else if (status == "failed public offline")
-    {
+        qtTrId("wallet-txs-status-failed-max-offline");
+    texts[static_cast<size_t>(TxObject::Status::FailedPublicOffline)] =
         /*% "failed
 public offline" */
-        return qtTrId("wallet-txs-status-failed-public-offline");
+        qtTrId("wallet-txs-status-failed-public-offline");
+    texts[static_cast<size_t>(TxObject::Status::Completed)] =
+        //% "completed"
+        qtTrId("wallet-txs-status-completed");
+    texts[static_cast<size_t>(TxObject::Status::Unknown)] =
+        //% "unknown"
+        qtTrId("wallet-txs-status-unknown");
+    return texts;
+}
+
+const QString& getStatusTextTranslated(TxObject::Status status)
+{
+    static StatusTexts texts;
+    if (!g_statusTextsValid)
+    {
+        texts = buildStatusTexts();
+        g_statusTextsValid = true;
     }
-    else if (status == "completed")
+
+    const auto idx = static_cast<size_t>(status);
+    return idx < texts.size() ? texts[idx] : texts[static_cast<size_t>(TxObject::Status::Unknown)];
+}
+
+// Search result of TxObjectList, rows are checked by their transaction ids
+class TxSearchMatches : public SearchMatches
+{
+public:
+    typedef std::unordered_set<TxID, ListModelKeyHash<TxID>> TxIDSet;
+
+    TxSearchMatches(const TxObjectList& list, std::shared_ptr<const TxIDSet> txIds)
+        : m_list(list)
+        , m_txIds(std::move(txIds))
     {
-        //% "completed"
-        return qtTrId("wallet-txs-status-completed");
     }
-    else
+
+    bool containsRow(int row) const override
     {
-        //% "unknown"
-        return qtTrId("wallet-txs-status-unknown");
+        return row >= 0 && row < m_list.rowCount() && m_txIds->count(m_list.get(row)->getTxID()) > 0;
     }
+
+private:
+    const TxObjectList& m_list;
+    std::shared_ptr<const TxIDSet> m_txIds;
+};
+
+// Wildcard queries are matched by the proxy model on the loaded rows only
+bool isPlainQuery(const QString& query)
+{
+    return std::none_of(query.begin(), query.end(), [](QChar c)
+    {
+        return c == '*' || c == '?' || c == '[' || c == ']';
+    });
 }
 
 }  // namespace
@@ -188,7 +179,200 @@ public offline" */
 TxObjectList::TxObjectList()
     : _amgr(AppModel::getInstance().getAssets())
 {
-    connect(_amgr.get(), &AssetsManager::assetInfo, this, &TxObjectList::onAssetInfo);
+    connect(_amgr.get(), &AssetsManager::assetsInfoChanged, this, &TxObjectList::onAssetsInfo);
+
+    auto& settings = AppModel::getInstance().getSettings();
+    connect(&settings, &WalletSettings::localeChanged, this, &TxObjectList::onLocaleChanged);
+    connect(&settings, &WalletSettings::secondCurrencyChanged, this, &TxObjectList::resetRoleCache);
+}
+
+beam::wallet::TxID TxObjectList::getItemKey(const std::shared_ptr<TxObject>& item) const
+{
+    return item->getTxID();
+}
+
+bool TxObjectList::isItemChanged(const std::shared_ptr<TxObject>& stored, const std::shared_ptr<TxObject>& item) const
+{
+    return !stored->getRow()->isSameState(*item->getRow());
+}
+
+void TxObjectList::onItemChanged(const beam::wallet::TxID& txId)
+{
+    // search index is kept by rows, see applyToPending
+    m_roleCache.erase(txId);
+}
+
+void TxObjectList::onItemsReset()
+{
+    m_roleCache.clear();
+}
+
+void TxObjectList::onItemStored(const std::shared_ptr<TxObject>& item)
+{
+    // new transactions can be inserted before the index has seen their rows
+    if (m_searchIndexBuilt && !m_searchIndex.contains(item->getTxID()))
+    {
+        indexRow(item->getRow());
+        ++m_searchRevision;
+        m_acceptedPending = -1;
+    }
+}
+
+bool TxObjectList::isSearchRole(int role) const
+{
+    return role == static_cast<int>(Roles::Search);
+}
+
+uint64_t TxObjectList::getSearchRevision() const
+{
+    return m_searchRevision;
+}
+
+std::shared_ptr<const SearchMatches> TxObjectList::search(const QString& query) const
+{
+    return std::make_shared<TxSearchMatches>(*this, findMatches(query));
+}
+
+void TxObjectList::ensureSearchIndex() const
+{
+    if (m_searchIndexBuilt)
+    {
+        return;
+    }
+
+    for (const auto& item : m_list)
+    {
+        indexRow(item->getRow());
+    }
+    for (const auto& row : m_pending)
+    {
+        indexRow(row);
+    }
+    m_searchIndexBuilt = true;
+}
+
+void TxObjectList::indexRow(const TxRow::Ptr& row) const
+{
+    m_searchIndex.set(row->txId, getSearchText(*row));
+    m_searchRows[row->txId] = row;
+}
+
+std::shared_ptr<const TxObjectList::TxIDSet> TxObjectList::findMatches(const QString& query) const
+{
+    if (m_matches && m_matchesRevision == m_searchRevision && m_matchesQuery == query)
+    {
+        return m_matches;
+    }
+
+    ensureSearchIndex();
+    auto matches = std::make_shared<TxIDSet>();
+    m_searchIndex.find(query, [&matches](const beam::wallet::TxID& txId)
+    {
+        matches->insert(txId);
+    });
+
+    m_matches = std::move(matches);
+    m_matchesQuery = query;
+    m_matchesRevision = m_searchRevision;
+    return m_matches;
+}
+
+bool TxObjectList::getSortKey(int row, int role, SortKey& key) const
+{
+    if (row < 0 || row >= m_list.size())
+    {
+        return false;
+    }
+
+    const auto& value = m_list[row];
+    switch (static_cast<Roles>(role))
+    {
+        case Roles::TimeCreatedSort:
+            key = SortKey::fromUnsigned(value->timeCreated());
+            return true;
+        case Roles::AmountGeneralWithCurrencySort:
+        case Roles::AmountGeneralSort:
+            key = SortKey::fromUnsigned(value->getAmountValue());
+            return true;
+        case Roles::StatusSort:
+            key = SortKey::fromUnsigned(static_cast<uint64_t>(value->getStatusCode()));
+            return true;
+        case Roles::AddressFromSort:
+        case Roles::AddressToSort:
+            // formatted addresses are cached with the rest of the role values
+            key = SortKey::fromText(data(createIndex(row, 0), role).toString());
+            return true;
+        default:
+            return false;
+    }
+}
+
+QString TxObjectList::getSearchText(const TxRow& row)
+{
+    // the same texts as the roles show, pending rows are searched without objects
+    QString r = row.txIdHex;
+    r.append(" ");
+    r.append(row.kernelID);
+    r.append(" ");
+    r.append(TxObject::getAddressFrom(row));
+    r.append(" ");
+    r.append(TxObject::getAddressTo(row));
+    r.append(" ");
+    r.append(TxObject::getComment(row));
+    r.append(" ");
+    r.append(row.senderIdentity);
+    r.append(" ");
+    r.append(row.receiverIdentity);
+    r.append(" ");
+    r.append(row.token);
+    return r;
+}
+
+void TxObjectList::onLocaleChanged()
+{
+    // Translator is connected to the settings before any list is created,
+    // so new translation is already installed here. Texts are rebuilt on the next request.
+    g_statusTextsValid = false;
+    resetRoleCache();
+}
+
+void TxObjectList::resetRoleCache()
+{
+    m_roleCache.clear();
+    if (!m_list.isEmpty())
+    {
+        emit dataChanged(createIndex(0, 0), createIndex(m_list.size() - 1, 0));
+    }
+}
+
+bool TxObjectList::isCachedRole(Roles role)
+{
+    switch (role)
+    {
+        case Roles::TimeCreated:
+        case Roles::AmountGeneralWithCurrency:
+        case Roles::AmountGeneral:
+        case Roles::Rate:
+        case Roles::AddressFrom:
+        case Roles::AddressFromSort:
+        case Roles::AddressTo:
+        case Roles::AddressToSort:
+        case Roles::Fee:
+        case Roles::Comment:
+        case Roles::TxID:
+        case Roles::FailureReason:
+        case Roles::Search:
+        case Roles::Token:
+        case Roles::SenderIdentity:
+        case Roles::ReceiverIdentity:
+        case Roles::UnitName:
+        case Roles::Icon:
+        case Roles::AssetFilter:
+            return true;
+        default:
+            // cheap or depends on the current height
+            return false;
+    }
 }
 
 QHash<int, QByteArray> TxObjectList::roleNames() const
@@ -252,8 +436,28 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
        return QVariant();
     }
     
-    auto& value = m_list[index.row()];
-    switch (static_cast<Roles>(role))
+    const auto& value = m_list[index.row()];
+    const auto txRole = static_cast<Roles>(role);
+    if (!isCachedRole(txRole))
+    {
+        return getRoleValue(value, txRole);
+    }
+
+    auto& rowCache = m_roleCache[value->getTxID()];
+    const auto it = rowCache.constFind(role);
+    if (it != rowCache.constEnd())
+    {
+        return *it;
+    }
+
+    auto result = getRoleValue(value, txRole);
+    rowCache.insert(role, result);
+    return result;
+}
+
+QVariant TxObjectList::getRoleValue(const std::shared_ptr<TxObject>& value, Roles role) const
+{
+    switch (role)
     {
         case Roles::TimeCreated:
         {
@@ -295,8 +499,9 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
         case Roles::AddressToSort:
             return value->getAddressTo();
         case Roles::Status:
+            return getStatusTextTranslated(value->getStatusCode());
         case Roles::StatusSort:
-            return getStatusTextTranslated(value->getStatus(), value->getAddressType());
+            return static_cast<int>(value->getStatusCode());
         case Roles::Fee:
             return value->getFee();
         case Roles::Comment:
@@ -325,6 +530,15 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
             return value->isContractTx();
         case Roles::IsDexTx:
             return value->isDexTx();
+        case Roles::AssetFilter:
+        {
+            QVariantList assets;
+            for (const auto assetId : value->getAssetsList())
+            {
+                assets.push_back(static_cast<uint>(assetId));
+            }
+            return assets;
+        }
         case Roles::IsIncome:
             return value->isIncome();
         case Roles::IsInProgress:
@@ -348,24 +562,7 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
         case Roles::RawTxID:
             return QVariant::fromValue(value->getTxID());
         case Roles::Search: 
-        {
-            QString r = value->getTransactionID();
-            r.append(" ");
-            r.append(value->getKernelID());
-            r.append(" ");
-            r.append(value->getAddressFrom());
-            r.append(" ");
-            r.append(value->getAddressTo());
-            r.append(" ");
-            r.append(value->getComment());
-            r.append(" ");
-            r.append(value->getSenderIdentity());
-            r.append(" ");
-            r.append(value->getReceiverIdentity());
-            r.append(" ");
-            r.append(value->getToken());
-            return r;
-        }
+            return getSearchText(*value->getRow());
         case Roles::StateDetails:
             return value->getStateDetails();
         case Roles::Token:
@@ -399,15 +596,432 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
     }
 }
 
-void TxObjectList::onAssetInfo(beam::Asset::ID assetId)
+void TxObjectList::setPaging(int pageSize, TxObjectCreator creator)
+{
+    m_pageSize = std::max(pageSize, 0);
+    m_creator = std::move(creator);
+    if (!m_pageSize)
+    {
+        m_pending.clear();
+        m_acceptedPending = -1;
+    }
+}
+
+int TxObjectList::getPageSize() const
+{
+    return m_pageSize;
+}
+
+void TxObjectList::setFilter(int assetId, const QByteArray& statusRole, const QString& search)
+{
+    m_assetFilter = assetId;
+    m_statusFilter = statusRole.isEmpty() ? 0 : roleNames().key(statusRole, 0);
+    m_searchFilter = search;
+    m_acceptedPending = -1;
+}
+
+const TxObjectList::TxIDSet* TxObjectList::getFilterMatches() const
+{
+    if (m_searchFilter.isEmpty() || !isPlainQuery(m_searchFilter))
+    {
+        return nullptr;
+    }
+    return findMatches(m_searchFilter).get();
+}
+
+bool TxObjectList::isAccepted(const TxRow& row, const TxIDSet* matches) const
+{
+    using namespace beam::wallet;
+
+    if (matches && matches->find(row.txId) == matches->end())
+    {
+        return false;
+    }
+
+    if (m_assetFilter >= 0 &&
+        std::find(row.assets.begin(), row.assets.end(), static_cast<beam::Asset::ID>(m_assetFilter)) == row.assets.end())
+    {
+        return false;
+    }
+
+    // the same as the roles of TxObject
+    switch (static_cast<Roles>(m_statusFilter))
+    {
+        case Roles::IsInProgress:
+            return row.status == TxStatus::Pending || row.status == TxStatus::InProgress || row.status == TxStatus::Registering;
+        case Roles::IsSent:
+            return row.status == TxStatus::Completed && !row.income;
+        case Roles::IsReceived:
+            return row.status == TxStatus::Completed && row.income;
+        default:
+            // other roles are checked by the proxy model on the loaded rows only
+            return true;
+    }
+}
+
+std::vector<TxRow::Ptr> TxObjectList::getAcceptedMatches(const TxIDSet& matches) const
+{
+    std::vector<TxRow::Ptr> rows;
+    for (const auto& txId : matches)
+    {
+        if (indexOf(txId) >= 0)
+        {
+            continue;
+        }
+
+        const auto it = m_searchRows.find(txId);
+        if (it != m_searchRows.end() && isAccepted(*it->second, &matches))
+        {
+            rows.push_back(it->second);
+        }
+    }
+
+    std::sort(rows.begin(), rows.end(), [](const TxRow::Ptr& l, const TxRow::Ptr& r)
+    {
+        return l->createTime > r->createTime;
+    });
+    return rows;
+}
+
+std::vector<TxRow::Ptr> TxObjectList::splitSnapshot(std::vector<TxRow::Ptr>&& txs, std::vector<TxRow::Ptr>& pending) const
+{
+    pending.clear();
+    if (!m_pageSize)
+    {
+        return std::move(txs);
+    }
+
+    std::sort(txs.begin(), txs.end(), [](const TxRow::Ptr& l, const TxRow::Ptr& r)
+    {
+        return l->createTime < r->createTime;
+    });
+
+    // the index is not built for the snapshot yet, search matches are loaded by fillPage() after it
+    std::vector<TxRow::Ptr> loaded;
+    loaded.reserve(std::min(txs.size(), static_cast<size_t>(m_pageSize)));
+    pending.reserve(txs.size());
+    for (auto it = txs.rbegin(); it != txs.rend(); ++it)
+    {
+        if (loaded.size() < static_cast<size_t>(m_pageSize) && isAccepted(**it, nullptr))
+        {
+            loaded.push_back(std::move(*it));
+        }
+        else
+        {
+            pending.push_back(std::move(*it));
+        }
+    }
+    std::reverse(pending.begin(), pending.end());
+    return loaded;
+}
+
+void TxObjectList::setPending(std::vector<TxRow::Ptr>&& pending, const std::vector<std::shared_ptr<TxObject>>& loaded)
+{
+    m_pending = std::move(pending);
+    m_acceptedPending = -1;
+
+    if (m_searchIndexBuilt)
+    {
+        // snapshot replaces all the rows, the index is built for it before the list is reconciled
+        m_searchIndex.clear();
+        m_searchRows.clear();
+        for (const auto& tx : loaded)
+        {
+            indexRow(tx->getRow());
+        }
+        for (const auto& row : m_pending)
+        {
+            indexRow(row);
+        }
+        ++m_searchRevision;
+    }
+}
+
+std::vector<TxRow::Ptr> TxObjectList::applyToPending(beam::wallet::ChangeAction action, std::vector<TxRow::Ptr>&& txs)
+{
+    using namespace beam::wallet;
+
+    if (m_searchIndexBuilt && !txs.empty())
+    {
+        for (const auto& tx : txs)
+        {
+            if (action == ChangeAction::Removed)
+            {
+                m_searchIndex.remove(tx->txId);
+                m_searchRows.erase(tx->txId);
+            }
+            else
+            {
+                indexRow(tx);
+            }
+        }
+        ++m_searchRevision;
+        m_acceptedPending = -1;
+    }
+
+    if (!m_pageSize)
+    {
+        return std::move(txs);
+    }
+
+    switch (action)
+    {
+        case ChangeAction::Updated:
+        {
+            if (m_pending.empty())
+            {
+                return std::move(txs);
+            }
+
+            std::unordered_map<TxID, size_t, ListModelKeyHash<TxID>> pendingIdx;
+            pendingIdx.reserve(m_pending.size());
+            for (size_t i = 0; i < m_pending.size(); ++i)
+            {
+                pendingIdx.emplace(m_pending[i]->txId, i);
+            }
+
+            std::vector<TxRow::Ptr> loaded;
+            for (auto& tx : txs)
+            {
+                const auto it = pendingIdx.find(tx->txId);
+                if (it != pendingIdx.end())
+                {
+                    m_pending[it->second] = std::move(tx);
+                    m_acceptedPending = -1;
+                }
+                else
+                {
+                    loaded.push_back(std::move(tx));
+                }
+            }
+            return loaded;
+        }
+
+        case ChangeAction::Removed:
+        {
+            if (!m_pending.empty())
+            {
+                std::unordered_set<TxID, ListModelKeyHash<TxID>> removed;
+                for (const auto& tx : txs)
+                {
+                    removed.insert(tx->txId);
+                }
+                m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), [&removed](const TxRow::Ptr& tx)
+                {
+                    return removed.find(tx->txId) != removed.end();
+                }), m_pending.end());
+                m_acceptedPending = -1;
+            }
+            return std::move(txs);
+        }
+
+        default:
+            // new transactions are the newest ones, always loaded
+            return std::move(txs);
+    }
+}
+
+void TxObjectList::releasePages()
+{
+    if (!m_pageSize)
+    {
+        return;
+    }
+
+    std::vector<std::shared_ptr<TxObject>> loaded(m_list.begin(), m_list.end());
+    std::sort(loaded.begin(), loaded.end(), [](const std::shared_ptr<TxObject>& l, const std::shared_ptr<TxObject>& r)
+    {
+        return l->timeCreated() > r->timeCreated();
+    });
+
+    // rows hidden by the filter are released too, they are fetched again when the filter is changed
+    const auto matches = getFilterMatches();
+    size_t kept = 0;
+    std::vector<std::shared_ptr<TxObject>> released;
+    for (const auto& tx : loaded)
+    {
+        if (kept < static_cast<size_t>(m_pageSize) && isAccepted(*tx->getRow(), matches))
+        {
+            ++kept;
+        }
+        else
+        {
+            released.push_back(tx);
+        }
+    }
+
+    if (!released.empty())
+    {
+        // released rows are newest first, they are merged into the sorted pending rows
+        const auto middle = m_pending.size();
+        m_pending.reserve(m_pending.size() + released.size());
+        for (auto it = released.rbegin(); it != released.rend(); ++it)
+        {
+            m_pending.push_back((*it)->getRow());
+        }
+        std::inplace_merge(m_pending.begin(), m_pending.begin() + middle, m_pending.end(), [](const TxRow::Ptr& l, const TxRow::Ptr& r)
+        {
+            return l->createTime < r->createTime;
+        });
+        m_acceptedPending = -1;
+        remove(released);
+    }
+
+    if (kept < static_cast<size_t>(m_pageSize))
+    {
+        loadPending(m_pageSize - kept, true);
+    }
+}
+
+void TxObjectList::fillPage()
+{
+    if (!m_pageSize)
+    {
+        return;
+    }
+
+    const auto matches = getFilterMatches();
+    size_t accepted = 0;
+    for (const auto& tx : m_list)
+    {
+        if (isAccepted(*tx->getRow(), matches) && ++accepted == static_cast<size_t>(m_pageSize))
+        {
+            return;
+        }
+    }
+    loadPending(m_pageSize - accepted, true);
+}
+
+void TxObjectList::fetchTransaction(const QString& txIdHex)
+{
+    if (!m_pageSize)
+    {
+        return;
+    }
+
+    const auto it = std::find_if(m_pending.rbegin(), m_pending.rend(), [&txIdHex](const TxRow::Ptr& row)
+    {
+        return row->txIdHex == txIdHex;
+    });
+    if (it == m_pending.rend())
+    {
+        return;
+    }
+
+    // whole pages down to the transaction, so the view has no gaps above it
+    const auto count = static_cast<size_t>(std::distance(m_pending.rbegin(), it)) + 1;
+    const auto pageSize = static_cast<size_t>(m_pageSize);
+    loadPending((count + pageSize - 1) / pageSize * pageSize, false);
+}
+
+void TxObjectList::loadPending(size_t count, bool acceptedOnly)
+{
+    if (!m_creator || m_pending.empty() || !count)
+    {
+        return;
+    }
+
+    std::vector<std::shared_ptr<TxObject>> page;
+    auto first = m_pending.size();
+    const auto matches = acceptedOnly ? getFilterMatches() : nullptr;
+    if (matches)
+    {
+        // only matched rows can be accepted, they are looked up instead of walking all pending rows
+        const auto rows = getAcceptedMatches(*matches);
+        std::vector<size_t> positions;
+        for (auto row = rows.begin(); row != rows.end() && positions.size() < count; ++row)
+        {
+            const auto range = std::equal_range(m_pending.begin(), m_pending.end(), *row, [](const TxRow::Ptr& l, const TxRow::Ptr& r)
+            {
+                return l->createTime < r->createTime;
+            });
+            const auto it = std::find(range.first, range.second, *row);
+            if (it != range.second)
+            {
+                // not found are the added ones which are not inserted yet
+                positions.push_back(static_cast<size_t>(it - m_pending.begin()));
+            }
+        }
+
+        // rows are nulled only after all of them are found, pending rows have to stay sorted for the lookup
+        page.reserve(positions.size());
+        for (const auto pos : positions)
+        {
+            page.push_back(m_creator(m_pending[pos]));
+            m_pending[pos].reset();
+            first = std::min(first, pos);
+        }
+    }
+    else
+    {
+        page.reserve(std::min(count, m_pending.size()));
+        for (auto i = m_pending.size(); i > 0 && page.size() < count; --i)
+        {
+            auto& row = m_pending[i - 1];
+            if (!acceptedOnly || isAccepted(*row, nullptr))
+            {
+                page.push_back(m_creator(row));
+                row.reset();
+                first = i - 1;
+            }
+        }
+    }
+
+    if (page.empty())
+    {
+        return;
+    }
+
+    // loaded rows are nulled, only the tail starting from the first of them is compacted
+    m_pending.erase(std::remove(m_pending.begin() + first, m_pending.end(), TxRow::Ptr()), m_pending.end());
+    m_acceptedPending = -1;
+    insert(page);
+}
+
+bool TxObjectList::canFetchMore(const QModelIndex& parent) const
+{
+    if (parent.isValid() || m_pending.empty())
+    {
+        return false;
+    }
+
+    if (m_acceptedPending < 0)
+    {
+        if (const auto matches = getFilterMatches())
+        {
+            m_acceptedPending = static_cast<int>(getAcceptedMatches(*matches).size());
+        }
+        else
+        {
+            m_acceptedPending = static_cast<int>(std::count_if(m_pending.begin(), m_pending.end(), [this](const TxRow::Ptr& row)
+            {
+                return isAccepted(*row, nullptr);
+            }));
+        }
+    }
+    return m_acceptedPending > 0;
+}
+
+void TxObjectList::fetchMore(const QModelIndex& parent)
+{
+    if (parent.isValid() || m_pending.empty())
+    {
+        return;
+    }
+
+    loadPending(m_pageSize, true);
+}
+
+void TxObjectList::onAssetsInfo(const std::set<beam::Asset::ID>& assetIds)
 {
     for (auto it = m_list.begin(); it != m_list.end(); ++it)
     {
         const auto& alist = (*it)->getAssetsList();
-        if(std::find(alist.begin(), alist.end(), assetId) != alist.end())
+        if(std::any_of(alist.begin(), alist.end(), [&assetIds](beam::Asset::ID id) { return assetIds.count(id) > 0; }))
         {
+            m_roleCache.erase((*it)->getTxID());
             const auto idx = it - m_list.begin();
-            ListModel::touch(idx);
+            touch(idx);
         }
     }
 }
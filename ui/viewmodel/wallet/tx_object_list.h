@@ -16,10 +16,16 @@
 
 #include "tx_object.h"
 #include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/search_index.h"
+#include "viewmodel/helpers/sort_key.h"
 #include "assets_manager.h"
 #include <QLocale>
+#include <functional>
+#include <unordered_set>
 
-class TxObjectList : public ListModel<std::shared_ptr<TxObject>>
+class TxObjectList : public KeyedListModel<std::shared_ptr<TxObject>, beam::wallet::TxID>
+                   , public SearchIndexProvider
+                   , public SortKeyProvider
 {
     Q_OBJECT
 public:
@@ -80,10 +86,101 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+    //
+    // Paged mode. Only the newest part of the history is turned into TxObjects,
+    // the rest is kept as rows and loaded page by page when view asks for more
+    //
+    typedef std::function<std::shared_ptr<TxObject>(const TxRow::Ptr&)> TxObjectCreator;
+    void setPaging(int pageSize, TxObjectCreator creator);
+    int getPageSize() const;
+
+    // Filter of the view. Loaded rows are filtered by the proxy model, not loaded ones
+    // are fetched only if they pass it. @assetId < 0, empty @statusRole and empty @search accept all rows
+    void setFilter(int assetId, const QByteArray& statusRole, const QString& search);
+
+    // Splits Reset snapshot: returns the newest page of rows accepted by the filter to be loaded,
+    // the rest is put to @pending. Current not loaded rows are kept until setPending(),
+    // so fetchMore() stays consistent meanwhile
+    std::vector<TxRow::Ptr> splitSnapshot(std::vector<TxRow::Ptr>&& txs, std::vector<TxRow::Ptr>& pending) const;
+    // @loaded are the objects of the newest part, they are reconciled with the list right after
+    void setPending(std::vector<TxRow::Ptr>&& pending, const std::vector<std::shared_ptr<TxObject>>& loaded);
+    // Applies changes to the search index and Updated and Removed changes to transactions which are not loaded yet.
+    // Returns transactions which should be applied to the loaded rows.
+    std::vector<TxRow::Ptr> applyToPending(beam::wallet::ChangeAction action, std::vector<TxRow::Ptr>&& txs);
+    // Keeps only the newest page of rows accepted by the filter loaded and fills it up if needed,
+    // other objects are turned back to pending rows
+    void releasePages();
+    // Loads accepted pending rows until a page of them is loaded, nothing is released
+    void fillPage();
+    // Fetches not loaded rows until the transaction with @txIdHex is loaded
+    void fetchTransaction(const QString& txIdHex);
+
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+    // SearchIndexProvider
+    bool isSearchRole(int role) const override;
+    uint64_t getSearchRevision() const override;
+    std::shared_ptr<const SearchMatches> search(const QString& query) const override;
+
+    // SortKeyProvider
+    bool getSortKey(int row, int role, SortKey& key) const override;
+
+protected:
+    beam::wallet::TxID getItemKey(const std::shared_ptr<TxObject>& item) const override;
+    bool isItemChanged(const std::shared_ptr<TxObject>& stored, const std::shared_ptr<TxObject>& item) const override;
+    void onItemChanged(const beam::wallet::TxID& txId) override;
+    void onItemsReset() override;
+    void onItemStored(const std::shared_ptr<TxObject>& item) override;
+
 private slots:
-    void onAssetInfo(beam::Asset::ID assetId);
+    void onAssetsInfo(const std::set<beam::Asset::ID>& assetIds);
+    void onLocaleChanged();
+    void resetRoleCache();
 
 private:
+    typedef std::unordered_set<beam::wallet::TxID, ListModelKeyHash<beam::wallet::TxID>> TxIDSet;
+
+    QVariant getRoleValue(const std::shared_ptr<TxObject>& value, Roles role) const;
+    // @matches are the matches of the search filter, null if rows are not filtered by search
+    bool isAccepted(const TxRow& row, const TxIDSet* matches) const;
+    const TxIDSet* getFilterMatches() const;
+    // Matched pending rows accepted by the filter, newest first
+    std::vector<TxRow::Ptr> getAcceptedMatches(const TxIDSet& matches) const;
+    // Loads up to @count newest pending rows, only accepted ones if @acceptedOnly
+    void loadPending(size_t count, bool acceptedOnly);
+    void ensureSearchIndex() const;
+    void indexRow(const TxRow::Ptr& row) const;
+    // Transactions which contain @query, the last result is kept for the proxy model and the filter
+    std::shared_ptr<const TxIDSet> findMatches(const QString& query) const;
+    static bool isCachedRole(Roles role);
+    static QString getSearchText(const TxRow& row);
+
     AssetsManager::Ptr _amgr;
     QLocale m_locale;
+
+    int m_pageSize = 0;
+    TxObjectCreator m_creator;
+    // not loaded transactions, oldest first, pages are taken from the back
+    std::vector<TxRow::Ptr> m_pending;
+    // number of pending rows accepted by the filter, -1 if not counted yet
+    mutable int m_acceptedPending = -1;
+
+    int m_assetFilter = -1;
+    // boolean role the rows should have, 0 if any status is shown
+    int m_statusFilter = 0;
+    QString m_searchFilter;
+
+    // Formatted role values per transaction, filled on first request
+    typedef QHash<int, QVariant> RoleCache;
+    mutable std::unordered_map<beam::wallet::TxID, RoleCache, ListModelKeyHash<beam::wallet::TxID>> m_roleCache;
+
+    // Built on the first search over loaded and pending rows and kept up to date after that
+    mutable SearchIndex<beam::wallet::TxID> m_searchIndex;
+    mutable std::unordered_map<beam::wallet::TxID, TxRow::Ptr, ListModelKeyHash<beam::wallet::TxID>> m_searchRows;
+    mutable bool m_searchIndexBuilt = false;
+    uint64_t m_searchRevision = 0;
+    mutable std::shared_ptr<const TxIDSet> m_matches;
+    mutable QString m_matchesQuery;
+    mutable uint64_t m_matchesRevision = 0;
 };
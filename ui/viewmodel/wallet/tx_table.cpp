@@ -17,6 +17,8 @@
 #include <QDateTime>
 #include <QTextStream>
 #include <QTextCodec>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 #include "model/app_model.h"
 
@@ -25,16 +27,55 @@ namespace
     const char kTxHistoryFileNamePrefix[] = "transactions_history_";
     const char kTxHistoryFileFormatDesc[] = "Comma-Separated Values (*.csv)";
     const char kTxHistoryFileNameFormat[] = "yyyy_MM_dd_HH_mm_ss";
+
+    bool isListedTx(const TxRow& row)
+    {
+        using namespace beam::wallet;
+
+        switch(row.txType)
+        {
+        case TxType::AtomicSwap:
+        case TxType::AssetIssue:
+        case TxType::AssetConsume:
+        case TxType::AssetReg:
+        case TxType::AssetUnreg:
+        case TxType::AssetInfo:
+        case TxType::PullTransaction:
+        case TxType::UnlinkFunds:
+        case TxType::VoucherRequest:
+        case TxType::VoucherResponse:
+            return false;
+
+        case TxType::ALL:
+            assert(!"This should not happen");
+            return false;
+
+        case TxType::Contract:
+        case TxType::PushTransaction:
+        case TxType::Simple:
+        case TxType::DexSimpleSwap:
+            return true;
+        }
+        return false;
+    }
 }
 
 TxTableViewModel::TxTableViewModel()
     : _model(*AppModel::getInstance().getWalletModel())
+    , _exchangeRatesManager(AppModel::getInstance().getRates())
 {
-    connect(&_model, SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)), SLOT(onTransactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
     connect(&_model, SIGNAL(txHistoryExportedToCsv(const QString&)), this, SLOT(onTxHistoryExportedToCsv(const QString&)));
-    connect(&_exchangeRatesManager, &ExchangeRatesManager::rateUnitChanged, this, &TxTableViewModel::rateChanged);
-    connect(&_exchangeRatesManager, &ExchangeRatesManager::activeRateChanged, this, &TxTableViewModel::rateChanged);
-    _model.getAsync()->getTransactions();
+    _exchangeRatesManager->subscribe(beam::wallet::ExchangeRate::Currency::Beam, this, &TxTableViewModel::rateChanged);
+}
+
+void TxTableViewModel::classBegin()
+{
+}
+
+void TxTableViewModel::componentComplete()
+{
+    _complete = true;
+    _model.getTxStore().subscribe(this, &TxTableViewModel::onTransactionsChanged);
 }
 
 void TxTableViewModel::exportTxHistoryToCsv()
@@ -59,6 +100,7 @@ void TxTableViewModel::onTxHistoryExportedToCsv(const QString& data)
 {
     if (!_txHistoryToCsvPaths.isEmpty())
     {
+        UiWatchdog::Activity activity("TxTableViewModel::writeCsv");
         const auto& path = _txHistoryToCsvPaths.dequeue();
         QFile file(path);
         if (file.open(QIODevice::WriteOnly | QIODevice::Text))
@@ -71,74 +113,213 @@ void TxTableViewModel::onTxHistoryExportedToCsv(const QString& data)
     }
 }
 
+int TxTableViewModel::getPageSize() const
+{
+    return _transactionsList.getPageSize();
+}
+
+void TxTableViewModel::setPageSize(int pageSize)
+{
+    if (pageSize == _transactionsList.getPageSize())
+    {
+        return;
+    }
+
+    _transactionsList.setPaging(pageSize, [this](const TxRow::Ptr& row)
+    {
+        return std::make_shared<TxObject>(row, _exchangeRatesManager->getRateUnitRaw(), _exchangeRatesManager->getHistory().get());
+    });
+
+    // before componentComplete() the history is not requested yet, it is split on arrival
+    if (_complete)
+    {
+        if (pageSize > 0)
+        {
+            // objects beyond the new page are turned back to rows
+            releasePages();
+        }
+        else
+        {
+            // pending rows are dropped with the paging, the whole history is loaded again
+            _model.getTxStore().getRows(this, [this](beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& rows)
+            {
+                onTransactionsChanged(action, rows);
+            });
+        }
+    }
+    emit pageSizeChanged();
+}
+
+int TxTableViewModel::getAssetFilter() const
+{
+    return _assetFilter;
+}
+
+void TxTableViewModel::setAssetFilter(int assetId)
+{
+    if (assetId != _assetFilter)
+    {
+        _assetFilter = assetId;
+        applyFilter();
+    }
+}
+
+QString TxTableViewModel::getStatusFilter() const
+{
+    return _statusFilter;
+}
+
+void TxTableViewModel::setStatusFilter(const QString& role)
+{
+    if (role != _statusFilter)
+    {
+        _statusFilter = role;
+        applyFilter();
+    }
+}
+
+QString TxTableViewModel::getSearchFilter() const
+{
+    return _searchFilter;
+}
+
+void TxTableViewModel::setSearchFilter(const QString& text)
+{
+    if (text == _searchFilter)
+    {
+        return;
+    }
+
+    _searchFilter = text;
+    _transactionsList.setFilter(_assetFilter, _statusFilter.toUtf8(), _searchFilter);
+    if (_complete && !_deferredChanges.isBusy())
+    {
+        // matches are loaded on top of the current pages, so a keystroke costs as much as its matches
+        _transactionsList.fillPage();
+    }
+    emit filterChanged();
+}
+
+void TxTableViewModel::applyFilter()
+{
+    _transactionsList.setFilter(_assetFilter, _statusFilter.toUtf8(), _searchFilter);
+    if (_complete)
+    {
+        // first page of the new filter is loaded, rows the filter hides are released
+        releasePages();
+    }
+    emit filterChanged();
+}
+
+void TxTableViewModel::releasePages()
+{
+    if (_deferredChanges.isBusy())
+    {
+        _releasePages = true;
+        return;
+    }
+    _transactionsList.releasePages();
+}
+
+void TxTableViewModel::fetchTransaction(const QString& txId)
+{
+    _transactionsList.fetchTransaction(txId);
+}
+
 QAbstractItemModel* TxTableViewModel::getTransactions()
 {
     return &_transactionsList;
 }
 
-void TxTableViewModel::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
+void TxTableViewModel::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& rows)
 {
     using namespace beam::wallet;
 
-    std::vector<std::shared_ptr<TxObject>> modifiedTransactions;
-    modifiedTransactions.reserve(transactions.size());
-    ExchangeRate::Currency secondCurrency = _exchangeRatesManager.getRateUnitRaw();
+    if (_deferredChanges.defer(action, rows))
+    {
+        return;
+    }
+
+    // rows are projected on the reactor thread, only the shared pointers are copied here
+    std::vector<TxRow::Ptr> listed;
+    listed.reserve(rows.size());
+    std::copy_if(rows.begin(), rows.end(), std::back_inserter(listed), [](const TxRow::Ptr& row)
+    {
+        return isListedTx(*row);
+    });
+
+    // not loaded pages keep rows only, objects are created on fetchMore.
+    // Older part of a snapshot replaces pending rows only when the newest part is applied,
+    // until then fetchMore works with the current rows
+    auto pending = std::make_shared<std::vector<TxRow::Ptr>>();
+    if (action == ChangeAction::Reset)
+    {
+        listed = _transactionsList.splitSnapshot(std::move(listed), *pending);
+    }
+    else
+    {
+        listed = _transactionsList.applyToPending(action, std::move(listed));
+    }
 
-    for (const auto& t : transactions)
+    // large resets are built on the thread pool, later changes wait for them
+    _deferredChanges.begin();
+    const auto secondCurrency = _exchangeRatesManager->getRateUnitRaw();
+    auto rateHistory = _exchangeRatesManager->getHistory();
+    beamui::buildObjects<TxObject>(this, std::move(listed), [secondCurrency, rateHistory](const TxRow::Ptr& row)
     {
-        if(const auto txType = t.GetParameter<TxType>(TxParameterID::TransactionType))
+        return std::make_shared<TxObject>(row, secondCurrency, rateHistory.get());
+    },
+    [this, action, pending](std::vector<std::shared_ptr<TxObject>>&& transactions)
+    {
+        if (action == ChangeAction::Reset)
         {
-            switch(*txType)
-            {
-            case TxType::AtomicSwap:
-            case TxType::AssetIssue:
-            case TxType::AssetConsume:
-            case TxType::AssetReg:
-            case TxType::AssetUnreg:
-            case TxType::AssetInfo:
-            case TxType::PullTransaction:
-            case TxType::UnlinkFunds:
-            case TxType::VoucherRequest:
-            case TxType::VoucherResponse:
-                continue;
-
-            case TxType::ALL:
-                assert(!"This should not happen");
-                continue;
-
-            case TxType::Contract:
-            case TxType::PushTransaction:
-            case TxType::Simple:
-            case TxType::DexSimpleSwap:
-                modifiedTransactions.push_back(std::make_shared<TxObject>(t, secondCurrency));
-                break;
-            }
+            _transactionsList.setPending(std::move(*pending), transactions);
         }
-    }
+        applyTransactions(action, transactions);
+        if (_releasePages)
+        {
+            _releasePages = false;
+            _transactionsList.releasePages();
+        }
+        else if (action == ChangeAction::Reset || !_searchFilter.isEmpty())
+        {
+            // search matches are not split from snapshots and can be typed while the build runs
+            _transactionsList.fillPage();
+        }
+        _deferredChanges.end([this](ChangeAction action, const std::vector<TxRow::Ptr>& rows)
+        {
+            onTransactionsChanged(action, rows);
+        });
+    });
+}
+
+void TxTableViewModel::applyTransactions(beam::wallet::ChangeAction action, const std::vector<std::shared_ptr<TxObject>>& transactions)
+{
+    using namespace beam::wallet;
 
     switch (action)
     {
         case ChangeAction::Reset:
             {
-                _transactionsList.reset(modifiedTransactions);
+                _transactionsList.reconcile(transactions);
                 break;
             }
 
         case ChangeAction::Removed:
             {
-                _transactionsList.remove(modifiedTransactions);
+                _transactionsList.remove(transactions);
                 break;
             }
 
         case ChangeAction::Added:
             {
-                _transactionsList.insert(modifiedTransactions);
+                _transactionsList.insert(transactions);
                 break;
             }
 
         case ChangeAction::Updated:
             {
-                _transactionsList.update(modifiedTransactions);
+                _transactionsList.update(transactions);
                 break;
             }
 
@@ -152,12 +333,12 @@ void TxTableViewModel::onTransactionsChanged(beam::wallet::ChangeAction action,
 
 QString TxTableViewModel::getRateUnit() const
 {
-    return beamui::getCurrencyUnitName(_exchangeRatesManager.getRateUnitRaw());
+    return beamui::getCurrencyUnitName(_exchangeRatesManager->getRateUnitRaw());
 }
 
 QString TxTableViewModel::getRate() const
 {
-    auto rate = _exchangeRatesManager.getRate(beam::wallet::ExchangeRate::Currency::Beam);
+    auto rate = _exchangeRatesManager->getRate(beam::wallet::ExchangeRate::Currency::Beam);
     return beamui::AmountToUIString(rate);
 }
 
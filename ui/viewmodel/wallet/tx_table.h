@@ -16,13 +16,20 @@
 #include <QObject>
 #include <QQueue>
 #include <QAbstractItemModel>
+#include <QtQml/qqmlparserstatus.h>
 #include "model/wallet_model.h"
 #include "tx_object_list.h"
+#include "viewmodel/helpers/parallel_build.h"
 #include "viewmodel/notifications/exchange_rates_manager.h"
 
-class TxTableViewModel: public QObject {
+class TxTableViewModel: public QObject, public QQmlParserStatus {
     Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
     Q_PROPERTY(QAbstractItemModel*  transactions READ getTransactions           NOTIFY transactionsChanged)
+    Q_PROPERTY(int pageSize         READ getPageSize    WRITE setPageSize   NOTIFY pageSizeChanged)
+    Q_PROPERTY(int assetFilter      READ getAssetFilter WRITE setAssetFilter NOTIFY filterChanged)
+    Q_PROPERTY(QString statusFilter READ getStatusFilter WRITE setStatusFilter NOTIFY filterChanged)
+    Q_PROPERTY(QString searchFilter READ getSearchFilter WRITE setSearchFilter NOTIFY filterChanged)
     Q_PROPERTY(QString rateUnit     READ getRateUnit    NOTIFY rateChanged)
     Q_PROPERTY(QString rate         READ getRate        NOTIFY rateChanged)
     Q_PROPERTY(QString explorerUrl  READ getExplorerUrl CONSTANT)
@@ -32,6 +39,14 @@ public:
     ~TxTableViewModel() override = default;
 
     QAbstractItemModel* getTransactions();
+    int getPageSize() const;
+    void setPageSize(int pageSize);
+    int getAssetFilter() const;
+    void setAssetFilter(int assetId);
+    QString getStatusFilter() const;
+    void setStatusFilter(const QString& role);
+    QString getSearchFilter() const;
+    void setSearchFilter(const QString& text);
     QString getRateUnit() const;
     QString getRate() const;
     QString getExplorerUrl() const;
@@ -40,18 +55,38 @@ public:
     Q_INVOKABLE void cancelTx(const QVariant& variantTxID);
     Q_INVOKABLE void deleteTx(const QVariant& variantTxID);
     Q_INVOKABLE PaymentInfoItem* getPaymentInfo(const QVariant& variantTxID);
+    // In paged mode drops loaded pages beyond the first one, called when the view is back at the newest transactions
+    Q_INVOKABLE void releasePages();
+    // In paged mode loads pages until the transaction is loaded, so it can be found in the model
+    Q_INVOKABLE void fetchTransaction(const QString& txId);
+
+    // QQmlParserStatus, history is requested when the page size is already set
+    void classBegin() override;
+    void componentComplete() override;
 
 public slots:
     void onTxHistoryExportedToCsv(const QString& data);
-    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<TxRow::Ptr>& rows);
 
 signals:
     void transactionsChanged();
     void rateChanged();
+    void pageSizeChanged();
+    void filterChanged();
 
 private:
+    void applyTransactions(beam::wallet::ChangeAction action, const std::vector<std::shared_ptr<TxObject>>& transactions);
+    void applyFilter();
+
     WalletModel&         _model;
     QQueue<QString>      _txHistoryToCsvPaths;
     TxObjectList         _transactionsList;
-    ExchangeRatesManager _exchangeRatesManager;
+    ExchangeRatesManager::Ptr _exchangeRatesManager;
+    beamui::DeferredChanges<TxRow::Ptr> _deferredChanges;
+    int _assetFilter = -1;
+    QString _statusFilter;
+    QString _searchFilter;
+    bool _complete = false;
+    // pages are released after the current build, objects being built can belong to them
+    bool _releasePages = false;
 };